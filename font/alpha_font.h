@@ -0,0 +1,41 @@
+/** Alpha Font
+ *  This file contains the anti-aliased font format.
+ *
+ *  An alpha font adds an alpha plane to each glyph of a Hexiwear font;
+ *  the character range, the glyph widths and the height come from the
+ *  source font. Alpha fonts are generated by the font converter in
+ *  host/alpha_font_compiler.cpp.
+ *
+ *  Alpha plane layout:
+ *    height rows of width pixels, bpp bits each, LSB first;
+ *    every row starts on a byte boundary.
+ *  0 is transparent and (1 << bpp) - 1 is the font color.
+ */
+
+#ifndef ALPHA_FONT_H_
+#define ALPHA_FONT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  typedef struct
+  {
+    const uint8_t *source;   // Hexiwear font this font adds alpha to
+    uint8_t bpp;             // bits per pixel: 2 or 4
+    const uint16_t *offsets; // offset of each alpha plane in data
+    const uint8_t *data;     // alpha planes
+  } AlphaFont;
+
+  // All the alpha fonts compiled in
+  extern const AlphaFont *const AlphaFonts[];
+  extern const uint8_t AlphaFontsCount;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ALPHA_FONT_H_
@@ -0,0 +1,660 @@
+/** OpenSans Alpha Font
+ *  This file contains the anti-aliased version of the OpenSans fonts.
+ *
+ *  Generated by host/alpha_font_compiler.cpp, do not edit.
+ */
+
+#include "opensans_font.h"
+#include "alpha_font.h"
+
+// 96 glyphs: 5580 bytes of 4-bit alpha planes, coverage derived from the bitmap
+static const uint16_t OpenSans_18_Regular_AlphaOffsets[] = {
+    0x0000, 0x0012, 0x0024, 0x0048, 0x0090, 0x00C6, 0x0120, 0x0168, 0x017A, 0x019E, 0x01C2, 0x01F8,
+    0x0240, 0x0252, 0x0276, 0x0288, 0x02BE, 0x02F4, 0x0318, 0x034E, 0x0384, 0x03CC, 0x0402, 0x0438,
+    0x046E, 0x04A4, 0x04DA, 0x04EC, 0x04FE, 0x0534, 0x056A, 0x05A0, 0x05D6, 0x0642, 0x068A, 0x06D2,
+    0x071A, 0x0762, 0x0798, 0x07E0, 0x0828, 0x0882, 0x0894, 0x08A6, 0x08EE, 0x0936, 0x09A2, 0x09FC,
+    0x0A56, 0x0A9E, 0x0AF8, 0x0B40, 0x0B76, 0x0BBE, 0x0C06, 0x0C4E, 0x0CBA, 0x0D02, 0x0D4A, 0x0D92,
+    0x0DB6, 0x0DEC, 0x0E10, 0x0E46, 0x0E7C, 0x0EB2, 0x0EE8, 0x0F30, 0x0F66, 0x0FAE, 0x0FE4, 0x101A,
+    0x1062, 0x10AA, 0x10BC, 0x10CE, 0x1104, 0x1116, 0x1170, 0x11B8, 0x1200, 0x1248, 0x1290, 0x12C6,
+    0x12FC, 0x1332, 0x137A, 0x13C2, 0x141C, 0x1452, 0x149A, 0x14D0, 0x1506, 0x152A, 0x1560, 0x15A8,
+};
+
+static const uint8_t OpenSans_18_Regular_AlphaData[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x21, 0xF2, 0xF2,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xF2, 0xF4,
+    0xF2, 0xF5, 0xF2, 0xF4, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0xF2, 0x22, 0x1F,
+    0x21, 0xF4, 0xF6, 0x25, 0xF1, 0xFF, 0xFF, 0xFF, 0x41, 0x4F, 0xF4, 0x24, 0x42, 0x4F, 0xF4, 0x14,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x42, 0x6F, 0x4F, 0x12, 0x31, 0x4F, 0x2F, 0x00, 0xF1, 0x22, 0x2F, 0x00,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0xF3, 0x24, 0x21,
+    0xFF, 0xFF, 0xF2, 0xF6, 0x24, 0xF2, 0xF6, 0x02, 0xF2, 0xFF, 0x14, 0x21, 0xF4, 0x2F, 0x00, 0xF2,
+    0xF6, 0x00, 0xF2, 0xF5, 0x21, 0xF4, 0xF6, 0xF1, 0xFF, 0x2F, 0x21, 0xF4, 0x13, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0x11, 0x01, 0xF2,
+    0x2F, 0x01, 0xF2, 0x02, 0xF2, 0xF6, 0x12, 0xF3, 0x02, 0xF2, 0xF5, 0x22, 0x4F, 0x22, 0xF2, 0xF5,
+    0x33, 0x4F, 0xFF, 0xF2, 0xF6, 0xF4, 0xF4, 0xF6, 0xF2, 0x4F, 0x3F, 0xF3, 0xF5, 0x21, 0x42, 0x2F,
+    0xF2, 0xF5, 0x00, 0xF2, 0x13, 0xF2, 0xF6, 0x00, 0xF2, 0x02, 0x21, 0xFF, 0x00, 0x11, 0x01, 0x10,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x12, 0x00, 0x20, 0xFF, 0x2F, 0x01, 0x20, 0x4F, 0xF4, 0x02, 0x20, 0x3F, 0xF3, 0x02,
+    0x20, 0x5F, 0x2F, 0x01, 0x41, 0xFF, 0x14, 0x11, 0xF2, 0x4F, 0x2F, 0xF2, 0xF2, 0x14, 0xF2, 0xF4,
+    0xF2, 0x24, 0x43, 0x4F, 0x21, 0xFF, 0xFF, 0xF4, 0x10, 0x22, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x01, 0x31, 0x0F, 0xF2, 0x0F, 0xF2, 0x04, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02,
+    0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x04, 0xF2, 0x0F, 0x31, 0x0F, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0xF2, 0x03, 0xF2, 0x0F, 0x41, 0x0F, 0x20, 0x0F,
+    0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x41, 0x0F, 0xF2, 0x0F, 0xF2, 0x03, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2,
+    0x02, 0x21, 0xF4, 0x24, 0xF1, 0xFF, 0xFF, 0x21, 0xF5, 0x25, 0x20, 0x5F, 0x2F, 0x20, 0x4F, 0x2F,
+    0x10, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00,
+    0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x22, 0xF4, 0x24, 0x02, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x22, 0xF4, 0x24, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0x11, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF3, 0x2F, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x02, 0xF1, 0x0F, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x21, 0x0F, 0x00, 0xF2, 0x03, 0x10, 0xF3, 0x02,
+    0x20, 0x3F, 0x01, 0x20, 0x2F, 0x00, 0x31, 0x2F, 0x00, 0xF2, 0x13, 0x00, 0xF3, 0x02, 0x00, 0x2F,
+    0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F,
+    0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2,
+    0x02, 0xF2, 0xF2, 0x24, 0xF4, 0x21, 0xFF, 0x2F, 0x10, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0xF3,
+    0x21, 0xFF, 0xF1, 0xF5, 0x11, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F, 0xF1, 0x23, 0xF4, 0x11, 0x01, 0xF2,
+    0x00, 0x10, 0xF3, 0x00, 0x21, 0x2F, 0x10, 0xF2, 0x12, 0x21, 0x2F, 0x01, 0xF2, 0x35, 0x22, 0xF2,
+    0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF2, 0xFF, 0x2F,
+    0xF2, 0x24, 0xF4, 0x11, 0x11, 0xF4, 0x10, 0x42, 0xFF, 0x10, 0xFF, 0x4F, 0x10, 0x22, 0xF4, 0x00,
+    0x00, 0xF2, 0x21, 0x22, 0xF4, 0xF1, 0xFF, 0x2F, 0x21, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x01, 0x00, 0x21, 0xFF, 0x02, 0x00, 0xF2, 0xF6, 0x02,
+    0x10, 0xF3, 0xF4, 0x02, 0x21, 0x2F, 0xF3, 0x02, 0xF2, 0x13, 0xF2, 0x02, 0xF4, 0x24, 0xF4, 0x04,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x22, 0x42, 0xFF, 0x04, 0x00, 0x20, 0xFF, 0x02, 0x00, 0x10, 0x22, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x24,
+    0x22, 0xF2, 0x24, 0x12, 0xF2, 0xFF, 0x2F, 0x21, 0x22, 0xF4, 0x00, 0x00, 0xF2, 0x00, 0x00, 0xF2,
+    0x21, 0x22, 0xF4, 0xF1, 0xFF, 0x2F, 0x21, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x22, 0x10, 0xF2, 0xFF, 0x21, 0x3F, 0x22, 0xF2, 0x35, 0x12, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4,
+    0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0x21, 0xFF, 0x2F, 0x10, 0x22, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF1, 0xFF, 0xFF, 0x21, 0x22, 0xF4, 0x00, 0x10, 0xF3,
+    0x00, 0x20, 0x3F, 0x00, 0x31, 0x2F, 0x00, 0xF2, 0x13, 0x10, 0xF3, 0x02, 0x20, 0x3F, 0x01, 0x20,
+    0x2F, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F,
+    0xF2, 0x24, 0xF4, 0xF2, 0x14, 0xF4, 0xF2, 0x5F, 0xFF, 0x41, 0xFF, 0x4F, 0xF2, 0x24, 0xF4, 0xF2,
+    0x02, 0xF2, 0xF2, 0x24, 0xF4, 0x21, 0xFF, 0x2F, 0x10, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2,
+    0x24, 0xF4, 0x21, 0xFF, 0xFF, 0x10, 0x32, 0xF6, 0x21, 0x32, 0xFF, 0xF1, 0xFF, 0x23, 0x21, 0x22,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0xF2, 0xF2, 0x11, 0x00, 0x11, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0xF2, 0xF2, 0x11, 0x00, 0x11, 0xF2, 0xF3, 0x2F, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x21, 0xF3, 0x21, 0xF3, 0x2F, 0xF2, 0x4F, 0x12, 0xF2, 0x4F, 0x12, 0x21, 0xF3, 0x2F, 0x00,
+    0x21, 0xF3, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF1, 0xFF, 0xFF, 0x41,
+    0x55, 0x45, 0xF1, 0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF1, 0x23, 0x01, 0x21,
+    0xFF, 0x23, 0x10, 0x42, 0xFF, 0x10, 0x42, 0xFF, 0x21, 0xFF, 0x23, 0xF1, 0x23, 0x01, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF1,
+    0xFF, 0x3F, 0x21, 0x42, 0xFF, 0x00, 0x10, 0xF4, 0x10, 0x32, 0x2F, 0x20, 0xFF, 0x12, 0x20, 0x3F,
+    0x01, 0x10, 0x12, 0x00, 0x20, 0x2F, 0x00, 0x20, 0x2F, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x22, 0x22, 0x12, 0x00, 0x10, 0x32, 0xFF, 0xFF, 0x2F, 0x01, 0x20, 0xFF, 0x44, 0x45, 0xF4, 0x02,
+    0x31, 0x4F, 0xF3, 0xFF, 0x32, 0x0F, 0xF2, 0x23, 0x4F, 0xF4, 0x22, 0x0F, 0xF2, 0x33, 0x2F, 0xF2,
+    0x22, 0x0F, 0xF2, 0xF4, 0x14, 0xF2, 0x22, 0x0F, 0xF2, 0x33, 0x4F, 0xF4, 0x44, 0x0F, 0xF2, 0x23,
+    0xFF, 0x4F, 0xFF, 0x02, 0x21, 0x4F, 0x54, 0x34, 0x22, 0x01, 0x10, 0xF2, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x21, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0x00, 0xF2, 0x2F, 0x00, 0x00, 0xF2, 0x2F, 0x00, 0x10, 0xF3,
+    0x3F, 0x01, 0x20, 0x4F, 0xF4, 0x02, 0x41, 0x4F, 0xF4, 0x14, 0xF2, 0xFF, 0xFF, 0x2F, 0xF2, 0x24,
+    0x42, 0x2F, 0xF3, 0x02, 0x20, 0x3F, 0x2F, 0x01, 0x10, 0xF2, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0xF2, 0xFF,
+    0xFF, 0x02, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0xFF,
+    0xFF, 0x04, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0xFF,
+    0xFF, 0x02, 0x21, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x10, 0xF2, 0xFF, 0xFF, 0x21, 0x3F, 0x22, 0x22, 0xF2, 0x13,
+    0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x13,
+    0x00, 0x00, 0x21, 0x3F, 0x22, 0x12, 0x10, 0xF2, 0xFF, 0x1F, 0x00, 0x21, 0x22, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0xF2, 0xFF,
+    0xFF, 0x12, 0xF2, 0x24, 0x32, 0x2F, 0xF2, 0x02, 0x10, 0xF3, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02,
+    0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02, 0x10, 0xF3, 0xF2, 0x24, 0x32, 0x2F, 0xF2, 0xFF,
+    0xFF, 0x12, 0x21, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22,
+    0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x24, 0x22, 0xF2, 0x02, 0x00, 0xF2, 0x24, 0x22, 0xF2, 0xFF, 0xFF,
+    0xF2, 0x24, 0x22, 0xF2, 0x02, 0x00, 0xF2, 0x24, 0x22, 0xF2, 0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x02, 0xF2, 0xFF, 0xFF, 0x0F,
+    0xF2, 0x24, 0x22, 0x02, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x24, 0x22, 0x01, 0xF2, 0xFF, 0xFF, 0x01,
+    0xF2, 0x24, 0x22, 0x01, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00,
+    0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x22, 0x22, 0x10, 0xF2, 0xFF, 0xFF, 0x21, 0x3F, 0x22, 0x22, 0xF2, 0x13, 0x00, 0x00,
+    0xF2, 0x02, 0x21, 0x22, 0xF2, 0x02, 0xF1, 0xFF, 0xF2, 0x02, 0x21, 0xF4, 0xF2, 0x13, 0x00, 0xF2,
+    0x21, 0x3F, 0x22, 0xF4, 0x10, 0xF2, 0xFF, 0xFF, 0x00, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x10,
+    0x01, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F,
+    0xF2, 0x24, 0x22, 0x42, 0x0F, 0xF2, 0xFF, 0xFF, 0xFF, 0x0F, 0xF2, 0x24, 0x22, 0x42, 0x0F, 0xF2,
+    0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0x11, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+    0xF2, 0xF2, 0xF3, 0x2F, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x11, 0xF2, 0x02, 0x21, 0x1F, 0xF2, 0x12,
+    0xF2, 0x12, 0xF2, 0x33, 0x3F, 0x01, 0xF2, 0xF6, 0x2F, 0x00, 0xF2, 0xFF, 0x2F, 0x00, 0xF2, 0x44,
+    0x3F, 0x01, 0xF2, 0x12, 0xF2, 0x12, 0xF2, 0x02, 0x31, 0x3F, 0xF2, 0x02, 0x20, 0xFF, 0x11, 0x01,
+    0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02,
+    0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x24,
+    0x22, 0x02, 0xF2, 0xFF, 0xFF, 0x0F, 0x21, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12,
+    0x00, 0x00, 0x21, 0x02, 0xF2, 0x3F, 0x01, 0x10, 0xF2, 0x0F, 0xF2, 0xFF, 0x02, 0x20, 0x6F, 0x0F,
+    0xF2, 0xF6, 0x02, 0x20, 0x5F, 0x0F, 0xF2, 0xF4, 0x13, 0x31, 0x4F, 0x0F, 0xF2, 0x33, 0x2F, 0xF2,
+    0x33, 0x0F, 0xF2, 0x22, 0x4F, 0xF4, 0x22, 0x0F, 0xF2, 0x22, 0xFF, 0x3F, 0x21, 0x0F, 0xF2, 0x12,
+    0xF4, 0x2F, 0x20, 0x0F, 0xF2, 0x02, 0xF2, 0x2F, 0x20, 0x0F, 0x11, 0x01, 0x21, 0x12, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0x10, 0x01, 0xF2, 0x3F, 0x01, 0x20, 0x0F,
+    0xF2, 0xFF, 0x02, 0x20, 0x0F, 0xF2, 0xF6, 0x13, 0x20, 0x0F, 0xF2, 0x33, 0x3F, 0x21, 0x0F, 0xF2,
+    0x22, 0xFF, 0x22, 0x0F, 0xF2, 0x12, 0xF3, 0x33, 0x0F, 0xF2, 0x02, 0x31, 0x6F, 0x0F, 0xF2, 0x02,
+    0x20, 0xFF, 0x0F, 0xF2, 0x02, 0x10, 0xF3, 0x0F, 0x11, 0x01, 0x00, 0x21, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x22, 0x12, 0x00, 0x10, 0xF2, 0xFF, 0x2F, 0x01, 0x21, 0x3F, 0x22, 0xF3, 0x02, 0xF2,
+    0x13, 0x00, 0x31, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02,
+    0x00, 0x20, 0x0F, 0xF2, 0x13, 0x00, 0x31, 0x0F, 0x21, 0x3F, 0x22, 0xF3, 0x02, 0x10, 0xF2, 0xFF,
+    0x2F, 0x01, 0x00, 0x21, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0xF2, 0xFF, 0xFF, 0x02, 0xF2, 0x24,
+    0x42, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0xFF,
+    0xFF, 0x02, 0xF2, 0x24, 0x22, 0x01, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0x00, 0x10, 0xF2, 0xFF, 0x2F, 0x01, 0x21, 0x3F, 0x22, 0xF3,
+    0x02, 0xF2, 0x13, 0x00, 0x31, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x02, 0x00, 0x20, 0x0F,
+    0xF2, 0x02, 0x00, 0x20, 0x0F, 0xF2, 0x13, 0x00, 0x31, 0x0F, 0x21, 0x3F, 0x22, 0xF3, 0x02, 0x10,
+    0xF2, 0xFF, 0x3F, 0x01, 0x00, 0x21, 0x42, 0x3F, 0x01, 0x00, 0x00, 0x10, 0xF2, 0x01, 0x00, 0x00,
+    0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0xF2, 0xFF, 0xFF, 0x02,
+    0xF2, 0x24, 0x42, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0xFF, 0xFF, 0x03,
+    0xF2, 0x24, 0xF4, 0x02, 0xF2, 0x02, 0xF2, 0x03, 0xF2, 0x02, 0x31, 0x0F, 0xF2, 0x02, 0x20, 0x0F,
+    0x11, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x22, 0x21,
+    0xFF, 0xFF, 0xF2, 0x24, 0x22, 0xF2, 0x14, 0x00, 0xF2, 0x4F, 0x12, 0x31, 0xFF, 0x2F, 0x10, 0x22,
+    0xF4, 0x00, 0x00, 0xF2, 0x21, 0x22, 0xF4, 0xF1, 0xFF, 0x2F, 0x21, 0x22, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0x22, 0xF4,
+    0x24, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2,
+    0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0x11,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x00, 0x11, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02,
+    0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x13, 0x10, 0xF3, 0x31, 0x4F,
+    0x32, 0x2F, 0x20, 0xFF, 0xFF, 0x12, 0x10, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x2F, 0x01, 0x10, 0xF2, 0xF3, 0x02,
+    0x20, 0x3F, 0xF2, 0x14, 0x41, 0x2F, 0xF2, 0x2F, 0xF2, 0x2F, 0x41, 0x2F, 0xF2, 0x14, 0x20, 0x4F,
+    0xF4, 0x02, 0x20, 0xFF, 0xFF, 0x02, 0x10, 0xF4, 0x4F, 0x01, 0x00, 0xF2, 0x2F, 0x00, 0x00, 0x21,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x21, 0x12, 0x00, 0x11, 0x2F, 0x01, 0xF2, 0x2F,
+    0x10, 0xF2, 0xF3, 0x02, 0xF2, 0x2F, 0x20, 0x3F, 0xF2, 0x12, 0xF3, 0x3F, 0x21, 0x2F, 0xF2, 0x24,
+    0x4F, 0xF4, 0x22, 0x2F, 0xF2, 0x4F, 0x2F, 0xF2, 0x33, 0x2F, 0x41, 0x6F, 0x2F, 0xF2, 0xF5, 0x13,
+    0x20, 0xFF, 0x13, 0x31, 0xFF, 0x02, 0x20, 0xFF, 0x02, 0x20, 0xFF, 0x02, 0x10, 0xF3, 0x02, 0x20,
+    0x3F, 0x01, 0x00, 0x11, 0x01, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x11, 0xF2, 0x13,
+    0x31, 0x2F, 0xF2, 0x2F, 0xF2, 0x2F, 0x31, 0x4F, 0xF4, 0x13, 0x10, 0xF3, 0x3F, 0x01, 0x00, 0xF2,
+    0x4F, 0x01, 0x10, 0xF3, 0xFF, 0x02, 0x21, 0x3F, 0xF4, 0x13, 0xF3, 0x13, 0x31, 0x3F, 0xFF, 0x02,
+    0x20, 0xFF, 0x22, 0x01, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x2F, 0x01, 0x21, 0x0F, 0xF3, 0x02, 0xF2, 0x03, 0xF2, 0x13,
+    0xF3, 0x02, 0x31, 0x5F, 0x3F, 0x01, 0x20, 0xFF, 0x2F, 0x00, 0x10, 0xF4, 0x14, 0x00, 0x00, 0xF2,
+    0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0xF1, 0xFF,
+    0xFF, 0x02, 0x21, 0x32, 0xF5, 0x02, 0x00, 0x31, 0x3F, 0x01, 0x00, 0xF2, 0x2F, 0x00, 0x10, 0xF3,
+    0x13, 0x00, 0x20, 0x3F, 0x01, 0x00, 0x31, 0x2F, 0x00, 0x00, 0xF3, 0x35, 0x22, 0x02, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xF2, 0xFF, 0xF2, 0x24,
+    0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x24,
+    0xF2, 0xFF, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x2F, 0x01, 0x00, 0xF3, 0x02, 0x00, 0xF2, 0x13, 0x00, 0x31, 0x2F,
+    0x00, 0x20, 0x2F, 0x00, 0x20, 0x3F, 0x01, 0x10, 0xF3, 0x02, 0x00, 0xF2, 0x03, 0x00, 0x21, 0x0F,
+    0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xFF, 0x0F, 0x42, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F,
+    0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x42, 0x0F, 0xFF, 0x0F, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10,
+    0xF2, 0x12, 0x20, 0x5F, 0x2F, 0x31, 0x4F, 0x3F, 0xF2, 0x13, 0xF3, 0xF2, 0x02, 0xF2, 0x11, 0x01,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x22, 0x22, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF1, 0x02, 0x00, 0x21, 0x0F, 0x00, 0x10,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x12, 0x10, 0xFF, 0x2F, 0x10, 0x22, 0xF4, 0x10, 0x22, 0xF4,
+    0x21, 0xFF, 0xFF, 0xF2, 0x24, 0xF4, 0xF2, 0x24, 0xF4, 0xF2, 0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00,
+    0xF2, 0x23, 0x22, 0x01, 0xF2, 0xF5, 0xFF, 0x02, 0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0x14, 0x20, 0x0F,
+    0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x14, 0x20, 0x0F, 0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0xF4, 0xFF, 0x02,
+    0x11, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x22, 0x22, 0x21, 0xFF, 0xFF, 0xF2, 0x24, 0x22, 0xF2, 0x02, 0x00, 0xF2, 0x02,
+    0x00, 0xF2, 0x02, 0x00, 0xF2, 0x24, 0x12, 0x21, 0xFF, 0x1F, 0x10, 0x22, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x10, 0x22,
+    0x32, 0x0F, 0x21, 0xFF, 0x5F, 0x0F, 0xF2, 0x24, 0xF3, 0x0F, 0xF2, 0x02, 0x41, 0x0F, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x02, 0x41, 0x0F, 0xF2, 0x24, 0xF3, 0x0F, 0x21, 0xFF, 0x4F, 0x0F, 0x10, 0x22,
+    0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x24, 0xF4, 0xF2, 0xFF, 0xFF, 0xF2,
+    0x24, 0x22, 0xF2, 0x24, 0x22, 0x21, 0xFF, 0xFF, 0x10, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x02,
+    0x31, 0xFF, 0x0F, 0xF2, 0x4F, 0x02, 0xF4, 0x26, 0x01, 0xFF, 0xFF, 0x01, 0xF4, 0x24, 0x01, 0xF2,
+    0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x22, 0x22, 0x02, 0xF2, 0xFF, 0xFF, 0x0F, 0xF2, 0x24, 0xF4, 0x04, 0xF2, 0x24,
+    0xF4, 0x02, 0xF2, 0xFF, 0x2F, 0x01, 0xF2, 0x24, 0x12, 0x00, 0xF2, 0x24, 0x22, 0x01, 0x42, 0xFF,
+    0xFF, 0x02, 0xFF, 0x23, 0x43, 0x0F, 0x5F, 0x23, 0xF4, 0x03, 0xF2, 0xFF, 0xFF, 0x02, 0x21, 0x22,
+    0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x23, 0x22, 0x01, 0xF2, 0xF5,
+    0xFF, 0x02, 0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0x14, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0x11, 0x01, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF1,
+    0x21, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0xF1, 0x21, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF4, 0xFF, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00,
+    0xF2, 0x02, 0x11, 0xF2, 0x12, 0xF2, 0xF2, 0x23, 0x2F, 0xF2, 0xF6, 0x13, 0xF2, 0xFF, 0x14, 0xF2,
+    0xF6, 0x3F, 0xF2, 0x33, 0xFF, 0xF2, 0x12, 0xF3, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+    0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x22, 0x21, 0x22, 0xF2, 0xF4, 0xFF, 0xF4, 0xFF, 0xF2, 0x3F,
+    0xF4, 0x3F, 0xF4, 0xF2, 0x14, 0xF2, 0x14, 0xF2, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2,
+    0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x11, 0x01, 0x11, 0x01,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x22, 0x01, 0xF2, 0xF4, 0xFF, 0x02,
+    0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0x14, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F,
+    0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0x11, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x22, 0x01, 0x31, 0xFF, 0xFF, 0x03, 0xF2, 0x4F, 0xF4, 0x0F, 0xF2, 0x14, 0x41, 0x0F,
+    0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x14, 0x41, 0x0F, 0xF2, 0x4F, 0xF4, 0x0F, 0x31, 0xFF, 0xFF, 0x03,
+    0x10, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x22, 0x01, 0xF2, 0xF4, 0xFF, 0x02,
+    0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0x14, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x14, 0x20, 0x0F,
+    0xF2, 0x3F, 0x42, 0x0F, 0xF2, 0xF5, 0xFF, 0x02, 0xF2, 0x23, 0x22, 0x01, 0xF2, 0x02, 0x00, 0x00,
+    0xF2, 0x02, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x12, 0x01, 0x21, 0xFF, 0x4F, 0x0F, 0xF2, 0x24, 0xF3, 0x0F, 0xF2, 0x02, 0x41, 0x0F,
+    0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x41, 0x0F, 0xF2, 0x24, 0xF3, 0x0F, 0x21, 0xFF, 0x5F, 0x0F,
+    0x10, 0x22, 0x32, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x21, 0x02, 0xF2, 0xF4, 0x0F, 0xF2, 0x3F, 0x02, 0xF2, 0x14, 0x00, 0xF2, 0x02,
+    0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x24,
+    0x02, 0xF2, 0x24, 0x01, 0x21, 0xFF, 0x02, 0x10, 0x42, 0x0F, 0x21, 0x42, 0x0F, 0xF1, 0xFF, 0x0F,
+    0x21, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF3, 0x24,
+    0x02, 0xFF, 0xFF, 0x0F, 0xF4, 0x24, 0x02, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x14, 0x00,
+    0xF2, 0x4F, 0x02, 0x31, 0xFF, 0x0F, 0x10, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x01, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02,
+    0x41, 0x0F, 0xF2, 0x24, 0xF3, 0x0F, 0x21, 0xFF, 0x4F, 0x0F, 0x10, 0x22, 0x12, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x2F, 0x01, 0x21, 0x0F, 0xF3, 0x02, 0xF2, 0x03, 0xF2, 0x14,
+    0xF4, 0x02, 0xF2, 0x4F, 0xFF, 0x02, 0x41, 0x5F, 0x4F, 0x01, 0x20, 0x5F, 0x2F, 0x00, 0x10, 0xF2,
+    0x12, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x10, 0x22, 0x01, 0x11, 0x2F, 0x21, 0xFF, 0x12, 0xF2, 0xF3, 0x22, 0xFF, 0x22, 0x3F, 0xF2,
+    0x33, 0xFF, 0x33, 0x2F, 0xF2, 0xF4, 0x44, 0x4F, 0x2F, 0xF2, 0xF6, 0x22, 0x6F, 0x2F, 0x31, 0xFF,
+    0x22, 0xFF, 0x13, 0x20, 0x3F, 0x11, 0xF3, 0x02, 0x10, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x11, 0xF2, 0x13, 0xF3, 0xF2, 0x4F, 0xFF, 0x31, 0x5F, 0x3F, 0x10, 0xF4, 0x14, 0x31, 0x5F, 0x3F,
+    0xF2, 0x4F, 0xFF, 0xF2, 0x13, 0xF3, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x2F, 0x01,
+    0x21, 0x0F, 0xF3, 0x02, 0xF2, 0x03, 0xF2, 0x14, 0xF4, 0x02, 0xF2, 0x4F, 0xFF, 0x02, 0x41, 0x5F,
+    0x4F, 0x01, 0x20, 0x5F, 0x2F, 0x00, 0x10, 0xF3, 0x13, 0x00, 0x10, 0xF3, 0x02, 0x00, 0x42, 0x3F,
+    0x01, 0x00, 0xFF, 0x2F, 0x00, 0x00, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF1,
+    0xFF, 0x2F, 0x21, 0x53, 0x2F, 0x10, 0xF2, 0x12, 0x20, 0x3F, 0x01, 0x31, 0x2F, 0x00, 0xF2, 0x35,
+    0x22, 0xF2, 0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x02, 0x10,
+    0xF2, 0x0F, 0x20, 0x4F, 0x02, 0x20, 0x2F, 0x00, 0x20, 0x2F, 0x00, 0x42, 0x2F, 0x00, 0xFF, 0x14,
+    0x00, 0x42, 0x2F, 0x00, 0x20, 0x2F, 0x00, 0x20, 0x2F, 0x00, 0x20, 0x4F, 0x02, 0x10, 0xF2, 0x0F,
+    0x00, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0xF2,
+    0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2,
+    0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0xFF, 0x12, 0x00, 0x42, 0x2F, 0x00, 0x20,
+    0x2F, 0x00, 0x20, 0x2F, 0x00, 0x20, 0x4F, 0x02, 0x10, 0xF4, 0x0F, 0x20, 0x4F, 0x02, 0x20, 0x2F,
+    0x00, 0x20, 0x2F, 0x00, 0x42, 0x2F, 0x00, 0xFF, 0x12, 0x00, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x22, 0x01, 0x00, 0xF1, 0xFF, 0x23, 0x02, 0x21, 0x32, 0xFF, 0x0F, 0x00, 0x10, 0x22, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xFF, 0x0F,
+    0x6F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x6F, 0x0F,
+    0xFF, 0x0F, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const AlphaFont OpenSans_18_Regular_Alpha = {
+    OpenSans_18_Regular,
+    4,
+    OpenSans_18_Regular_AlphaOffsets,
+    OpenSans_18_Regular_AlphaData};
+
+// 96 glyphs: 4050 bytes of 4-bit alpha planes, coverage derived from the bitmap
+static const uint16_t OpenSans_15_Regular_AlphaOffsets[] = {
+    0x0000, 0x000F, 0x001E, 0x003C, 0x0078, 0x00A5, 0x00E1, 0x011D, 0x012C, 0x013B, 0x0159, 0x0186,
+    0x01B3, 0x01C2, 0x01E0, 0x01EF, 0x020D, 0x023A, 0x0258, 0x0285, 0x02B2, 0x02DF, 0x030C, 0x0339,
+    0x0366, 0x0393, 0x03C0, 0x03CF, 0x03DE, 0x040B, 0x0438, 0x0465, 0x0492, 0x04DD, 0x0519, 0x0546,
+    0x0582, 0x05BE, 0x05EB, 0x0618, 0x0654, 0x0690, 0x069F, 0x06AE, 0x06EA, 0x0717, 0x0762, 0x079E,
+    0x07DA, 0x0807, 0x0843, 0x0870, 0x089D, 0x08CA, 0x0906, 0x0942, 0x098D, 0x09BA, 0x09E7, 0x0A14,
+    0x0A32, 0x0A50, 0x0A6E, 0x0A9B, 0x0AC8, 0x0AE6, 0x0B13, 0x0B40, 0x0B6D, 0x0B9A, 0x0BC7, 0x0BE5,
+    0x0C12, 0x0C3F, 0x0C4E, 0x0C5D, 0x0C8A, 0x0C99, 0x0CE4, 0x0D11, 0x0D3E, 0x0D6B, 0x0D98, 0x0DB6,
+    0x0DE3, 0x0E01, 0x0E2E, 0x0E5B, 0x0EA6, 0x0ED3, 0x0F00, 0x0F2D, 0x0F4B, 0x0F69, 0x0F87, 0x0FB4,
+};
+
+static const uint8_t OpenSans_15_Regular_AlphaData[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x21, 0xF1, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x02, 0xF2, 0x0F, 0xF2, 0x0F, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x11, 0xF2, 0x02,
+    0x31, 0x4F, 0xF4, 0x04, 0xF1, 0xFF, 0xFF, 0x0F, 0x41, 0x6F, 0x4F, 0x02, 0x42, 0x6F, 0x4F, 0x01,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF4, 0x44, 0x3F, 0x01, 0xF2, 0x12, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x01, 0x10, 0xF3, 0x24, 0x21, 0xFF, 0xFF, 0xF2, 0xF6, 0x24, 0xF2, 0xF6, 0x14,
+    0xF2, 0xFF, 0x2F, 0x21, 0xF4, 0xF6, 0x21, 0xF4, 0xF6, 0xF1, 0xFF, 0x2F, 0x21, 0x22, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x12, 0x10, 0x11, 0xF2, 0x2F, 0x21, 0x1F, 0xF2, 0xF6, 0xF4, 0x13, 0xF2, 0xF5, 0xF6,
+    0x24, 0xF2, 0xF6, 0x6F, 0xFF, 0xF2, 0x6F, 0xFF, 0xF6, 0x21, 0xF4, 0xF6, 0xF5, 0x10, 0xF3, 0xF4,
+    0xF6, 0x10, 0x2F, 0x21, 0xFF, 0x10, 0x11, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x12,
+    0x00, 0x21, 0xFF, 0x2F, 0x00, 0xF2, 0x44, 0x2F, 0x00, 0xF2, 0x44, 0x2F, 0x00, 0x41, 0xFF, 0x13,
+    0x01, 0xF2, 0xF5, 0x23, 0x0F, 0xF2, 0x23, 0x4F, 0x0F, 0xF2, 0x34, 0xF4, 0x04, 0xF2, 0xFF, 0x4F,
+    0x0F, 0x21, 0x22, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0xF2, 0xF2, 0xF3, 0x3F, 0x2F, 0x2F, 0x3F, 0xF3, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x01, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x03, 0x31, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x31,
+    0x0F, 0xF2, 0x03, 0xF2, 0x02, 0xF2, 0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x11, 0x00, 0x20, 0x2F, 0x00, 0x42, 0x4F, 0x22, 0xFF, 0xFF, 0xFF, 0x52, 0xFF,
+    0x25, 0xF1, 0x33, 0x1F, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2, 0x02, 0x21, 0xF4, 0x24, 0xF1, 0xFF,
+    0xFF, 0x21, 0xF4, 0x24, 0x00, 0xF2, 0x02, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF3,
+    0x2F, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x02, 0xF1, 0x0F, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF1, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0xF2, 0x20, 0x3F, 0x20, 0x2F, 0x31, 0x2F, 0xF2,
+    0x13, 0xF2, 0x02, 0xF3, 0x02, 0x2F, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x01, 0x21, 0xFF, 0x02, 0xF2, 0x44, 0x0F, 0xF2,
+    0x22, 0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x44, 0x0F, 0x21, 0xFF,
+    0x02, 0x10, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x21, 0xFF, 0xF1, 0xF5, 0x11, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2,
+    0x00, 0xF2, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x22, 0x01, 0xF1, 0xFF, 0x02, 0x21, 0x42, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x31, 0x0F,
+    0x10, 0xF2, 0x02, 0x21, 0x2F, 0x01, 0xF2, 0x35, 0x02, 0xF2, 0xFF, 0x0F, 0x21, 0x22, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22,
+    0x02, 0xF1, 0xFF, 0x0F, 0x21, 0x42, 0x0F, 0x10, 0x42, 0x0F, 0x10, 0xFF, 0x04, 0x10, 0x42, 0x0F,
+    0x11, 0x20, 0x0F, 0x3F, 0x42, 0x0F, 0xF2, 0xFF, 0x02, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0xF2,
+    0x2F, 0x10, 0xF3, 0x2F, 0x21, 0x5F, 0x2F, 0xF2, 0x33, 0x2F, 0xF4, 0x44, 0x4F, 0xFF, 0xFF, 0xFF,
+    0x22, 0x42, 0x4F, 0x00, 0x20, 0x2F, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x24,
+    0x02, 0xF2, 0x24, 0x02, 0xF2, 0xFF, 0x0F, 0x21, 0x42, 0x0F, 0x00, 0x20, 0x0F, 0x21, 0x42, 0x0F,
+    0xF1, 0xFF, 0x02, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x02, 0x21, 0xFF, 0x0F, 0xF2, 0x24, 0x02, 0xF2, 0x24,
+    0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x44, 0x0F, 0x21, 0xFF, 0x0F,
+    0x10, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x22, 0x02, 0xFF, 0xFF, 0x0F, 0x22, 0x42, 0x0F, 0x00, 0x31, 0x0F, 0x00, 0xF2,
+    0x03, 0x10, 0xF3, 0x02, 0x20, 0x3F, 0x01, 0x20, 0x2F, 0x00, 0x20, 0x2F, 0x00, 0x10, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x22, 0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0x44, 0x0F, 0x41, 0xFF, 0x04, 0xF2, 0x44,
+    0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0xFF, 0x0F, 0x21, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x01, 0xF2,
+    0xFF, 0x02, 0xF2, 0x44, 0x0F, 0xF2, 0x22, 0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0xFF, 0x0F, 0x21, 0x42,
+    0x0F, 0x21, 0x42, 0x0F, 0xF1, 0xFF, 0x02, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF1, 0x11, 0x00, 0x00, 0x11, 0xF1, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0xF1, 0x11, 0x00, 0x00, 0x11, 0xF2, 0xF3, 0x2F, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x21, 0x0F,
+    0x21, 0xF3, 0x02, 0xF2, 0x2F, 0x01, 0xF2, 0x25, 0x01, 0x21, 0xFF, 0x02, 0x10, 0x32, 0x0F, 0x00,
+    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02,
+    0xF1, 0xFF, 0x0F, 0x41, 0x55, 0x04, 0xF1, 0xFF, 0x0F, 0x21, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF1, 0x12, 0x00, 0x21, 0x3F, 0x02, 0x10, 0xF2, 0x0F,
+    0x10, 0x52, 0x0F, 0x21, 0xFF, 0x02, 0xF1, 0x23, 0x01, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+    0x01, 0xFF, 0xFF, 0x02, 0x22, 0x42, 0x0F, 0x00, 0x31, 0x0F, 0x10, 0xF2, 0x02, 0x10, 0x2F, 0x01,
+    0x10, 0x11, 0x00, 0x21, 0x12, 0x00, 0xF1, 0x1F, 0x00, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x22, 0x22, 0x01, 0x10, 0xF2, 0xFF, 0xFF, 0x02, 0x21, 0x4F, 0x54, 0x44, 0x0F,
+    0xF2, 0x34, 0xFF, 0x4F, 0x0F, 0xF2, 0xF4, 0x44, 0x5F, 0x0F, 0xF2, 0xF5, 0x22, 0x5F, 0x0F, 0xF2,
+    0xF5, 0x44, 0x6F, 0x0F, 0xF2, 0xF4, 0xFF, 0xFF, 0x0F, 0xF2, 0x44, 0x55, 0x34, 0x02, 0x21, 0xFF,
+    0xFF, 0x1F, 0x00, 0x10, 0x22, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x10, 0xF2, 0x12,
+    0x00, 0x20, 0x5F, 0x2F, 0x00, 0x20, 0x5F, 0x2F, 0x00, 0x31, 0x4F, 0x3F, 0x01, 0xF2, 0x45, 0xF5,
+    0x02, 0xF2, 0xFF, 0xFF, 0x02, 0xF3, 0x24, 0xF4, 0x03, 0x2F, 0x01, 0x21, 0x0F, 0x11, 0x00, 0x10,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x22, 0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x24, 0xF4, 0xF2, 0x24, 0xF4, 0xF2, 0xFF,
+    0x4F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0xF2, 0xFF, 0xFF, 0x21, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x22, 0x22, 0x01, 0x31, 0xFF, 0xFF, 0x01, 0xF2, 0x4F, 0x22, 0x01, 0xF2, 0x14,
+    0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x14, 0x00, 0x00, 0xF2, 0x4F,
+    0x22, 0x01, 0x31, 0xFF, 0xFF, 0x01, 0x10, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22,
+    0x22, 0x01, 0xF2, 0xFF, 0xFF, 0x03, 0xF2, 0x24, 0xF4, 0x0F, 0xF2, 0x02, 0x41, 0x0F, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x41, 0x0F, 0xF2, 0x24, 0xF4, 0x0F, 0xF2, 0xFF,
+    0xFF, 0x03, 0x21, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x24, 0x02,
+    0xF2, 0x24, 0x02, 0xF2, 0xFF, 0x0F, 0xF2, 0x24, 0x02, 0xF2, 0x02, 0x00, 0xF2, 0x24, 0x02, 0xF2,
+    0xFF, 0x0F, 0x21, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x24, 0x22, 0xF2, 0x02, 0x00,
+    0xF2, 0x24, 0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x24, 0x22, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x11,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02, 0x21, 0xF3, 0xFF, 0x0F, 0xF2, 0x3F, 0x22, 0x02,
+    0xF2, 0x14, 0x00, 0x00, 0xF2, 0x02, 0x21, 0x02, 0xF2, 0x02, 0xF1, 0x0F, 0xF2, 0x14, 0x41, 0x0F,
+    0xF2, 0x4F, 0x42, 0x0F, 0x31, 0xFF, 0xFF, 0x0F, 0x10, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x01, 0x10, 0x01, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F,
+    0xF2, 0xFF, 0xFF, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F,
+    0xF2, 0x02, 0x20, 0x0F, 0x11, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0x2F, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x01, 0xF2, 0x12,
+    0xF2, 0x01, 0xF2, 0x33, 0x3F, 0x01, 0xF2, 0xF6, 0x2F, 0x00, 0xF2, 0xFF, 0x14, 0x00, 0xF2, 0xF6,
+    0x13, 0x00, 0xF2, 0x23, 0x2F, 0x01, 0xF2, 0x12, 0xF2, 0x02, 0xF2, 0x02, 0x21, 0x0F, 0x11, 0x01,
+    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2,
+    0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x24, 0x22, 0xF2, 0xFF, 0xFF, 0x21, 0x22,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0x21, 0x02, 0xF2, 0x2F, 0x00, 0xF2, 0x0F,
+    0xF2, 0x2F, 0x00, 0xF2, 0x0F, 0xF2, 0x3F, 0x11, 0xF3, 0x0F, 0xF2, 0xF6, 0x22, 0x6F, 0x0F, 0xF2,
+    0xF4, 0x44, 0x4F, 0x0F, 0xF2, 0x33, 0xFF, 0x33, 0x0F, 0xF2, 0x22, 0xFF, 0x22, 0x0F, 0xF2, 0x22,
+    0xFF, 0x22, 0x0F, 0x11, 0x11, 0x22, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x10, 0x01, 0xF2, 0x13, 0x20, 0x0F, 0xF2, 0x2F, 0x21, 0x0F, 0xF2, 0xF6, 0x22, 0x0F, 0xF2, 0xF4,
+    0x33, 0x0F, 0xF2, 0x33, 0x4F, 0x0F, 0xF2, 0x22, 0x6F, 0x0F, 0xF2, 0x12, 0xF2, 0x0F, 0xF2, 0x02,
+    0x31, 0x0F, 0x11, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x22, 0x12, 0x31, 0xFF,
+    0xFF, 0x3F, 0xF2, 0x4F, 0x42, 0xFF, 0xF2, 0x14, 0x10, 0xF4, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02,
+    0x00, 0xF2, 0xF2, 0x14, 0x10, 0xF4, 0xF2, 0x4F, 0x42, 0xFF, 0x31, 0xFF, 0xFF, 0x3F, 0x10, 0x22,
+    0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2,
+    0x24, 0xF4, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0x12, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x22, 0x22, 0x12, 0x31, 0xFF, 0xFF, 0x3F, 0xF2, 0x4F, 0x42, 0xFF, 0xF2,
+    0x14, 0x10, 0xF4, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x02, 0x00, 0xF2, 0xF2, 0x14, 0x10, 0xF4, 0xF2,
+    0x4F, 0x42, 0xFF, 0x31, 0xFF, 0xFF, 0x3F, 0x10, 0x22, 0xF4, 0x14, 0x00, 0x00, 0x21, 0x1F, 0x00,
+    0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF2,
+    0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0xF2, 0xFF, 0x3F, 0xF2, 0x44,
+    0x3F, 0xF2, 0x12, 0xF3, 0xF2, 0x02, 0xF2, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x02, 0x21, 0xFF, 0x0F, 0xF2,
+    0x24, 0x02, 0xF2, 0x14, 0x00, 0xF2, 0x3F, 0x02, 0x21, 0xF3, 0x0F, 0x00, 0x41, 0x0F, 0x21, 0x42,
+    0x0F, 0xF1, 0xFF, 0x02, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF1, 0xFF, 0xFF, 0x21, 0xF4, 0x24, 0x00,
+    0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2,
+    0x02, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x01, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02, 0x20, 0x0F, 0xF2, 0x02,
+    0x20, 0x0F, 0xF2, 0x24, 0x42, 0x0F, 0x21, 0xFF, 0xFF, 0x02, 0x10, 0x22, 0x22, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x2F, 0x01, 0x21, 0x0F, 0xF3, 0x02, 0xF2, 0x03, 0xF2, 0x02,
+    0xF2, 0x02, 0xF2, 0x13, 0xF3, 0x02, 0x31, 0x4F, 0x3F, 0x01, 0x20, 0x5F, 0x2F, 0x00, 0x20, 0x5F,
+    0x2F, 0x00, 0x10, 0xF2, 0x12, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x10, 0x22, 0x01, 0x11, 0x2F, 0x20, 0xFF, 0x12, 0xF2, 0x3F, 0x21, 0xFF, 0x22, 0x3F,
+    0xF3, 0x32, 0xFF, 0x33, 0x2F, 0xF2, 0xF4, 0x44, 0x4F, 0x2F, 0xF2, 0xF5, 0x22, 0x6F, 0x2F, 0xF2,
+    0xF6, 0x22, 0xFF, 0x13, 0x31, 0xFF, 0x22, 0xFF, 0x02, 0x20, 0x3F, 0x11, 0xF3, 0x02, 0x10, 0x11,
+    0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x2F, 0x11, 0xF2, 0xF2, 0x33, 0x2F, 0x31,
+    0xFF, 0x13, 0x20, 0xFF, 0x02, 0x31, 0xFF, 0x13, 0xF2, 0x44, 0x2F, 0xF3, 0x22, 0x3F, 0x2F, 0x11,
+    0xF2, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x2F, 0x11, 0xF2, 0xF3, 0x22, 0x3F, 0xF2, 0x44, 0x2F, 0x31,
+    0xFF, 0x13, 0x20, 0xFF, 0x02, 0x10, 0xF4, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x11,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x22, 0x12, 0xF1, 0xFF, 0x2F, 0x21, 0x53, 0x2F, 0x00, 0xF2, 0x13, 0x10, 0xF3, 0x02, 0x21,
+    0x2F, 0x01, 0xF2, 0x13, 0x00, 0xF4, 0x24, 0x22, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xF2, 0xFF, 0xF2, 0x24,
+    0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x24, 0xF2, 0xFF,
+    0x21, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2F, 0x01, 0xF3, 0x02, 0xF2, 0x02,
+    0xF2, 0x13, 0x31, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x10, 0xF2, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xFF, 0x0F, 0x42, 0x0F, 0x20, 0x0F, 0x20, 0x0F,
+    0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x20, 0x0F, 0x42, 0x0F, 0xFF, 0x0F, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x20, 0x3F, 0x01, 0x31, 0xFF, 0x12,
+    0xF2, 0x44, 0x2F, 0xF3, 0x22, 0x3F, 0x2F, 0x11, 0xF2, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x22, 0x02, 0xFF, 0xFF, 0x0F, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x10, 0x2F,
+    0x10, 0xF2, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x02, 0xF1, 0xFF, 0x0F, 0x41, 0x65, 0x0F, 0xF2, 0xFF,
+    0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0x44, 0x0F, 0xF2, 0xFF, 0x0F, 0x21, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2,
+    0x02, 0x00, 0xF2, 0x24, 0x12, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02,
+    0xF2, 0xF2, 0x24, 0xF4, 0xF2, 0xFF, 0x2F, 0x21, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x22, 0x02, 0x21, 0xFF, 0x0F, 0xF2, 0x24, 0x02, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x24,
+    0x02, 0x21, 0xFF, 0x0F, 0x10, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xF2, 0x10, 0x22, 0xF4, 0x21,
+    0xFF, 0xFF, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0x21, 0xFF,
+    0xFF, 0x10, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x02, 0x21, 0xFF, 0x0F, 0xF2,
+    0x66, 0x0F, 0xF2, 0xFF, 0x0F, 0xF2, 0x24, 0x02, 0xF2, 0x24, 0x02, 0x21, 0xFF, 0x0F, 0x10, 0x22,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x21,
+    0xFF, 0xF3, 0x46, 0xFF, 0xFF, 0xF4, 0x24, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0x11,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0xF2, 0xFF, 0xFF, 0xF2, 0x44, 0x4F, 0xF2, 0x44, 0x2F,
+    0xF2, 0xFF, 0x12, 0xF2, 0x46, 0x12, 0xF3, 0xFF, 0x2F, 0x4F, 0x32, 0xF5, 0x4F, 0x42, 0xFF, 0xF2,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2, 0x02,
+    0x00, 0xF2, 0x24, 0x12, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2,
+    0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0xF1, 0x21, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0xF1, 0x21, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF4, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0xF2, 0x02, 0x00, 0xF2, 0x12, 0x01, 0xF2,
+    0x23, 0x0F, 0xF2, 0xF5, 0x02, 0xF2, 0x4F, 0x01, 0xF2, 0xF5, 0x02, 0xF2, 0x33, 0x0F, 0xF2, 0x22,
+    0x0F, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF2, 0xF2,
+    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x22, 0x12, 0x22, 0x22, 0xF2, 0xFF, 0x4F, 0xFF, 0xFF, 0xF2, 0x24, 0xF4, 0x24,
+    0xF4, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x02, 0xF2,
+    0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x11, 0x01, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x22, 0x12, 0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2,
+    0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x12, 0x21, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2,
+    0x24, 0xF4, 0x21, 0xFF, 0x2F, 0x10, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x12,
+    0xF2, 0xFF, 0x2F, 0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0xF2,
+    0xFF, 0x2F, 0xF2, 0x24, 0x12, 0xF2, 0x02, 0x00, 0xF2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x22, 0x21, 0xFF, 0xFF,
+    0xF2, 0x24, 0xF4, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x24, 0xF4, 0x21, 0xFF, 0xFF, 0x10,
+    0x22, 0xF4, 0x00, 0x00, 0xF2, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x22, 0xF2, 0xFF, 0xF2, 0x24, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02,
+    0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x02, 0x21, 0xFF, 0x0F, 0xF1, 0x34, 0x02, 0x21, 0x2F,
+    0x01, 0x10, 0xF2, 0x02, 0x21, 0x43, 0x0F, 0xF1, 0xFF, 0x02, 0x21, 0x22, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0xF3, 0x24, 0xFF,
+    0xFF, 0xF4, 0x24, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x24, 0xF2, 0xFF, 0x21, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x01, 0x11, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0xF2,
+    0x24, 0xF4, 0xF2, 0xFF, 0xFF, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11,
+    0x2F, 0x11, 0xF2, 0xF3, 0x22, 0x3F, 0xF2, 0x22, 0x2F, 0xF2, 0x44, 0x2F, 0x31, 0xFF, 0x13, 0x20,
+    0xFF, 0x02, 0x10, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x11, 0x10, 0x01, 0x2F, 0x21, 0x2F, 0x21, 0x0F, 0xF3, 0xF4,
+    0xF5, 0xF4, 0x03, 0xF2, 0xF5, 0xF5, 0xF5, 0x02, 0xF2, 0xF6, 0xF4, 0xF5, 0x02, 0xF2, 0x3F, 0xF2,
+    0xF5, 0x02, 0x31, 0x2F, 0x21, 0x2F, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x01, 0xF2, 0x22, 0x0F, 0xF2, 0x44, 0x0F, 0x31, 0xFF,
+    0x03, 0x31, 0xFF, 0x03, 0xF2, 0x44, 0x0F, 0xF2, 0x22, 0x0F, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x11, 0x2F, 0x11, 0xF2, 0xF3, 0x22, 0x3F, 0xF2, 0x22, 0x2F, 0xF2, 0x44,
+    0x2F, 0x31, 0xFF, 0x13, 0x20, 0xFF, 0x02, 0x20, 0x4F, 0x01, 0x42, 0x2F, 0x00, 0xFF, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x22, 0x02, 0xF1, 0xFF, 0x0F, 0x21, 0xF5, 0x03, 0x20, 0x3F, 0x01, 0x31, 0x2F, 0x00, 0xF3, 0x35,
+    0x02, 0xFF, 0xFF, 0x0F, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x22, 0x20, 0xFF, 0x20, 0x4F, 0x20, 0x2F, 0x31, 0x2F, 0xF2, 0x13, 0xF2,
+    0x13, 0x31, 0x2F, 0x20, 0x2F, 0x20, 0x4F, 0x20, 0xFF, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00,
+    0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x01, 0xFF, 0x02, 0xF4, 0x02, 0xF2, 0x02, 0xF2, 0x03, 0x31, 0x0F, 0x31, 0x0F, 0xF2, 0x03, 0xF2,
+    0x02, 0xF4, 0x02, 0xFF, 0x02, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0xF1, 0x3F, 0x02, 0x21,
+    0xF3, 0x0F, 0x00, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xFF, 0x0F, 0x6F, 0x0F, 0x5F, 0x0F,
+    0x5F, 0x0F, 0x5F, 0x0F, 0x5F, 0x0F, 0x6F, 0x0F, 0xFF, 0x0F, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+const AlphaFont OpenSans_15_Regular_Alpha = {
+    OpenSans_15_Regular,
+    4,
+    OpenSans_15_Regular_AlphaOffsets,
+    OpenSans_15_Regular_AlphaData};
+
+const AlphaFont *const AlphaFonts[] = {
+    &OpenSans_18_Regular_Alpha,
+    &OpenSans_15_Regular_Alpha,
+};
+
+const uint8_t AlphaFontsCount = sizeof(AlphaFonts) / sizeof(AlphaFonts[0]);
@@ -0,0 +1,290 @@
+/** OpenSans Span Font
+ *  This file contains the span-encoded version of the OpenSans fonts.
+ *
+ *  Generated by host/font_compiler.cpp, do not edit.
+ */
+
+#include "oled_info.h"
+#include "opensans_font.h"
+#include "span_font.h"
+
+#if OLED_SPAN_FONTS
+
+// 96 glyphs: 1756 bytes of spans, 1908 bytes of packed bitmaps
+static const uint8_t OpenSans_18_Regular_Widths[] = {
+    0x02, 0x02, 0x04, 0x08, 0x06, 0x0A, 0x08, 0x02, 0x03, 0x03, 0x06, 0x07, 0x02, 0x03, 0x02, 0x05,
+    0x06, 0x04, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02, 0x02, 0x06, 0x06, 0x06, 0x06,
+    0x0B, 0x08, 0x07, 0x08, 0x08, 0x06, 0x07, 0x08, 0x09, 0x02, 0x02, 0x08, 0x07, 0x0B, 0x09, 0x09,
+    0x07, 0x09, 0x07, 0x06, 0x07, 0x08, 0x08, 0x0C, 0x08, 0x07, 0x07, 0x04, 0x05, 0x03, 0x06, 0x06,
+    0x05, 0x06, 0x07, 0x06, 0x07, 0x06, 0x05, 0x07, 0x07, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x07, 0x07,
+    0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x0A, 0x06, 0x07, 0x06, 0x05, 0x04, 0x05, 0x07, 0x03,
+};
+
+static const uint16_t OpenSans_18_Regular_Offsets[] = {
+    0x0000, 0x0002, 0x0011, 0x001B, 0x0032, 0x004A, 0x006E, 0x0087, 0x008E, 0x00A1, 0x00B4, 0x00C1,
+    0x00CE, 0x00D5, 0x00D9, 0x00DE, 0x00EE, 0x0105, 0x0116, 0x0127, 0x0138, 0x014D, 0x015D, 0x0171,
+    0x0181, 0x0197, 0x01AB, 0x01B5, 0x01C0, 0x01CB, 0x01D1, 0x01DC, 0x01EB, 0x020D, 0x0222, 0x0238,
+    0x0248, 0x025F, 0x026F, 0x027F, 0x0293, 0x02AB, 0x02BB, 0x02CE, 0x02E6, 0x02F6, 0x031B, 0x0339,
+    0x0350, 0x0364, 0x037E, 0x0395, 0x03A5, 0x03B5, 0x03CD, 0x03E3, 0x0405, 0x041B, 0x042F, 0x043F,
+    0x0452, 0x0462, 0x0475, 0x0483, 0x0487, 0x048C, 0x049B, 0x04B3, 0x04C0, 0x04D8, 0x04E7, 0x04F8,
+    0x050D, 0x0525, 0x0534, 0x0547, 0x055E, 0x056F, 0x058A, 0x059E, 0x05B0, 0x05C8, 0x05E0, 0x05EE,
+    0x05FB, 0x0609, 0x061D, 0x0630, 0x064B, 0x065E, 0x0675, 0x0682, 0x0695, 0x06AB, 0x06BE, 0x06C3,
+};
+
+static const uint8_t OpenSans_18_Regular_Data[] = {
+    0x12, 0x00, 0x05, 0x09, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x05, 0x03, 0x22, 0x02, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x05, 0x09, 0x22, 0x21, 0x12,
+    0x22, 0x02, 0x30, 0x60, 0x30, 0x50, 0x16, 0x20, 0x50, 0x20, 0x50, 0x06, 0x20, 0x40, 0x20, 0x40,
+    0x10, 0x40, 0x04, 0x0B, 0x11, 0x22, 0x11, 0x22, 0x12, 0x01, 0x30, 0x23, 0x10, 0x30, 0x10, 0x30,
+    0x12, 0x31, 0x30, 0x50, 0x30, 0x50, 0x30, 0x50, 0x13, 0x30, 0x05, 0x09, 0x32, 0x43, 0x45, 0x33,
+    0x02, 0x11, 0x70, 0x10, 0x30, 0x70, 0x10, 0x30, 0x60, 0x10, 0x30, 0x60, 0x81, 0x10, 0x30, 0x50,
+    0x70, 0x90, 0x11, 0x40, 0x70, 0x90, 0x40, 0x70, 0x90, 0x30, 0x70, 0x90, 0x30, 0x81, 0x05, 0x09,
+    0x21, 0x22, 0x31, 0x23, 0x02, 0x22, 0x20, 0x50, 0x20, 0x50, 0x20, 0x40, 0x21, 0x11, 0x40, 0x70,
+    0x10, 0x50, 0x70, 0x10, 0x60, 0x23, 0x70, 0x05, 0x03, 0x11, 0x01, 0x10, 0x10, 0x10, 0x05, 0x0B,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x20, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11,
+    0x20, 0x05, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x11, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x11, 0x10, 0x04, 0x06, 0x11, 0x11, 0x22, 0x30, 0x30, 0x14, 0x30, 0x20, 0x40, 0x20,
+    0x40, 0x06, 0x07, 0x11, 0x11, 0x11, 0x01, 0x30, 0x30, 0x30, 0x06, 0x30, 0x30, 0x30, 0x0C, 0x03,
+    0x11, 0x01, 0x10, 0x10, 0x00, 0x0A, 0x01, 0x01, 0x11, 0x0C, 0x02, 0x11, 0x10, 0x10, 0x05, 0x09,
+    0x11, 0x11, 0x11, 0x11, 0x01, 0x40, 0x30, 0x30, 0x20, 0x20, 0x20, 0x10, 0x10, 0x00, 0x05, 0x09,
+    0x21, 0x22, 0x22, 0x22, 0x01, 0x22, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50,
+    0x10, 0x50, 0x10, 0x50, 0x22, 0x05, 0x09, 0x11, 0x12, 0x11, 0x11, 0x01, 0x30, 0x21, 0x10, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x05, 0x09, 0x21, 0x11, 0x11, 0x11, 0x01, 0x22, 0x10, 0x50,
+    0x50, 0x50, 0x40, 0x30, 0x20, 0x10, 0x14, 0x05, 0x09, 0x21, 0x11, 0x11, 0x11, 0x01, 0x13, 0x10,
+    0x50, 0x50, 0x41, 0x22, 0x50, 0x50, 0x50, 0x13, 0x05, 0x09, 0x21, 0x22, 0x22, 0x11, 0x01, 0x41,
+    0x30, 0x50, 0x30, 0x50, 0x20, 0x50, 0x10, 0x50, 0x10, 0x50, 0x06, 0x41, 0x41, 0x05, 0x09, 0x11,
+    0x11, 0x11, 0x11, 0x01, 0x14, 0x10, 0x10, 0x13, 0x50, 0x50, 0x50, 0x50, 0x13, 0x05, 0x09, 0x11,
+    0x11, 0x22, 0x22, 0x01, 0x32, 0x20, 0x10, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50,
+    0x22, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x14, 0x50, 0x50, 0x40, 0x40, 0x30, 0x30, 0x20,
+    0x20, 0x05, 0x09, 0x21, 0x22, 0x21, 0x22, 0x01, 0x22, 0x10, 0x50, 0x10, 0x50, 0x11, 0x41, 0x22,
+    0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x22, 0x05, 0x09, 0x21, 0x22, 0x12, 0x11, 0x01, 0x22, 0x10,
+    0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x23, 0x50, 0x41, 0x12, 0x07, 0x07, 0x11, 0x00, 0x10,
+    0x01, 0x10, 0x10, 0x10, 0x10, 0x07, 0x08, 0x11, 0x00, 0x10, 0x11, 0x10, 0x10, 0x10, 0x10, 0x00,
+    0x06, 0x06, 0x11, 0x11, 0x11, 0x50, 0x31, 0x11, 0x11, 0x31, 0x50, 0x08, 0x03, 0x01, 0x01, 0x14,
+    0x14, 0x06, 0x06, 0x11, 0x11, 0x11, 0x10, 0x21, 0x41, 0x41, 0x21, 0x10, 0x05, 0x09, 0x11, 0x11,
+    0x11, 0x10, 0x01, 0x13, 0x41, 0x50, 0x40, 0x21, 0x20, 0x20, 0x20, 0x05, 0x0A, 0x21, 0x43, 0x44,
+    0x34, 0x11, 0x44, 0x21, 0x90, 0x20, 0x52, 0xA0, 0x10, 0x40, 0x70, 0xA0, 0x10, 0x40, 0x70, 0xA0,
+    0x10, 0x30, 0x70, 0xA0, 0x10, 0x40, 0x70, 0xA0, 0x10, 0x42, 0x81, 0x20, 0x34, 0x05, 0x09, 0x11,
+    0x21, 0x12, 0x22, 0x02, 0x31, 0x31, 0x31, 0x20, 0x50, 0x20, 0x50, 0x15, 0x10, 0x60, 0x10, 0x60,
+    0x00, 0x70, 0x05, 0x09, 0x21, 0x22, 0x21, 0x22, 0x01, 0x14, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60,
+    0x14, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x14, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x34,
+    0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x33, 0x05, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x14,
+    0x10, 0x60, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x60, 0x14, 0x05,
+    0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x14, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x14, 0x05,
+    0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x15, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x05,
+    0x09, 0x11, 0x11, 0x22, 0x22, 0x01, 0x34, 0x20, 0x10, 0x10, 0x10, 0x52, 0x10, 0x70, 0x10, 0x70,
+    0x20, 0x70, 0x34, 0x05, 0x09, 0x22, 0x22, 0x21, 0x22, 0x02, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80,
+    0x10, 0x80, 0x17, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x05, 0x09, 0x11, 0x11, 0x11,
+    0x11, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x05, 0x0B, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x05, 0x09,
+    0x22, 0x22, 0x21, 0x22, 0x02, 0x10, 0x60, 0x10, 0x50, 0x10, 0x40, 0x10, 0x31, 0x13, 0x10, 0x40,
+    0x10, 0x50, 0x10, 0x60, 0x10, 0x61, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x15, 0x05, 0x09, 0x32, 0x44, 0x44, 0x33, 0x03, 0x11, 0x91, 0x12,
+    0x80, 0xA0, 0x10, 0x30, 0x80, 0xA0, 0x10, 0x30, 0x80, 0xA0, 0x10, 0x40, 0x70, 0xA0, 0x10, 0x40,
+    0x70, 0xA0, 0x10, 0x42, 0xA0, 0x10, 0x51, 0xA0, 0x10, 0x51, 0xA0, 0x05, 0x09, 0x22, 0x33, 0x33,
+    0x23, 0x02, 0x11, 0x80, 0x12, 0x80, 0x10, 0x30, 0x80, 0x10, 0x40, 0x80, 0x10, 0x41, 0x80, 0x10,
+    0x50, 0x80, 0x10, 0x60, 0x80, 0x10, 0x62, 0x10, 0x71, 0x05, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01,
+    0x33, 0x20, 0x70, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x20, 0x70, 0x33,
+    0x05, 0x09, 0x21, 0x22, 0x12, 0x11, 0x01, 0x14, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60,
+    0x14, 0x10, 0x10, 0x10, 0x05, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x11, 0x01, 0x33, 0x20, 0x70, 0x10,
+    0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x20, 0x70, 0x33, 0x60, 0x70, 0x05, 0x09,
+    0x21, 0x22, 0x21, 0x22, 0x02, 0x14, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x14, 0x10, 0x50, 0x10,
+    0x50, 0x10, 0x60, 0x10, 0x60, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x23, 0x10, 0x10, 0x11,
+    0x22, 0x50, 0x50, 0x50, 0x13, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x06, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x05, 0x09, 0x22, 0x22, 0x22, 0x22, 0x01, 0x10, 0x70, 0x10, 0x70,
+    0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x20, 0x60, 0x23, 0x05, 0x09, 0x22,
+    0x22, 0x22, 0x11, 0x01, 0x00, 0x70, 0x10, 0x60, 0x10, 0x60, 0x11, 0x51, 0x20, 0x50, 0x20, 0x50,
+    0x23, 0x31, 0x31, 0x05, 0x09, 0x33, 0x43, 0x44, 0x22, 0x02, 0x00, 0x51, 0xB0, 0x10, 0x51, 0xA0,
+    0x10, 0x51, 0xA0, 0x10, 0x40, 0x70, 0xA0, 0x11, 0x40, 0x70, 0xA0, 0x20, 0x40, 0x70, 0x90, 0x21,
+    0x81, 0x21, 0x81, 0x30, 0x80, 0x05, 0x09, 0x22, 0x12, 0x11, 0x22, 0x02, 0x10, 0x60, 0x11, 0x51,
+    0x20, 0x50, 0x31, 0x31, 0x32, 0x20, 0x50, 0x10, 0x60, 0x01, 0x61, 0x05, 0x09, 0x22, 0x22, 0x11,
+    0x11, 0x01, 0x00, 0x60, 0x10, 0x50, 0x10, 0x50, 0x20, 0x40, 0x22, 0x30, 0x30, 0x30, 0x30, 0x05,
+    0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x14, 0x50, 0x40, 0x31, 0x30, 0x20, 0x20, 0x10, 0x06, 0x05,
+    0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x12, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x10, 0x10, 0x20, 0x20, 0x20, 0x30,
+    0x30, 0x40, 0x05, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x02, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x02, 0x05, 0x05, 0x21, 0x22, 0x02, 0x30, 0x20, 0x40, 0x20, 0x40, 0x10,
+    0x50, 0x10, 0x50, 0x0F, 0x01, 0x01, 0x05, 0x04, 0x02, 0x11, 0x30, 0x40, 0x07, 0x07, 0x11, 0x11,
+    0x22, 0x01, 0x22, 0x50, 0x50, 0x23, 0x10, 0x50, 0x10, 0x50, 0x14, 0x04, 0x0A, 0x11, 0x21, 0x22,
+    0x22, 0x22, 0x10, 0x10, 0x10, 0x10, 0x32, 0x11, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x11,
+    0x60, 0x10, 0x32, 0x07, 0x07, 0x11, 0x11, 0x11, 0x01, 0x23, 0x10, 0x10, 0x10, 0x10, 0x10, 0x22,
+    0x04, 0x0A, 0x11, 0x21, 0x22, 0x22, 0x22, 0x60, 0x60, 0x60, 0x22, 0x60, 0x10, 0x51, 0x10, 0x60,
+    0x10, 0x60, 0x10, 0x60, 0x10, 0x51, 0x22, 0x60, 0x07, 0x07, 0x21, 0x12, 0x11, 0x01, 0x22, 0x10,
+    0x50, 0x10, 0x50, 0x14, 0x10, 0x10, 0x23, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11,
+    0x10, 0x03, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x0A, 0x21, 0x12, 0x11, 0x21, 0x12, 0x15,
+    0x10, 0x50, 0x10, 0x50, 0x13, 0x10, 0x10, 0x23, 0x01, 0x60, 0x00, 0x50, 0x14, 0x04, 0x0A, 0x11,
+    0x21, 0x22, 0x22, 0x22, 0x10, 0x10, 0x10, 0x10, 0x32, 0x11, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10,
+    0x60, 0x10, 0x60, 0x10, 0x60, 0x05, 0x09, 0x01, 0x11, 0x11, 0x11, 0x01, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x05, 0x0C, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x04, 0x0A, 0x11, 0x21, 0x22, 0x21, 0x22, 0x10, 0x10,
+    0x10, 0x10, 0x50, 0x10, 0x40, 0x10, 0x30, 0x12, 0x10, 0x31, 0x10, 0x41, 0x10, 0x50, 0x04, 0x0A,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07,
+    0x07, 0x33, 0x33, 0x33, 0x03, 0x10, 0x32, 0x72, 0x11, 0x51, 0x90, 0x10, 0x50, 0x90, 0x10, 0x50,
+    0x90, 0x10, 0x50, 0x90, 0x10, 0x50, 0x90, 0x10, 0x50, 0x90, 0x07, 0x07, 0x22, 0x22, 0x22, 0x02,
+    0x10, 0x32, 0x11, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x07, 0x07,
+    0x21, 0x22, 0x22, 0x01, 0x23, 0x11, 0x51, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x11, 0x51, 0x23,
+    0x07, 0x0A, 0x22, 0x22, 0x22, 0x12, 0x11, 0x10, 0x32, 0x11, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10,
+    0x60, 0x11, 0x60, 0x10, 0x32, 0x10, 0x10, 0x10, 0x07, 0x0A, 0x22, 0x22, 0x22, 0x12, 0x11, 0x22,
+    0x60, 0x10, 0x51, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x51, 0x22, 0x60, 0x60, 0x60, 0x60,
+    0x07, 0x07, 0x12, 0x11, 0x11, 0x01, 0x10, 0x31, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x07,
+    0x11, 0x11, 0x11, 0x01, 0x13, 0x10, 0x10, 0x21, 0x40, 0x40, 0x13, 0x06, 0x08, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x11, 0x22, 0x07, 0x07, 0x22, 0x22, 0x22, 0x02, 0x10,
+    0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x51, 0x22, 0x60, 0x07, 0x07, 0x22,
+    0x22, 0x22, 0x01, 0x00, 0x60, 0x10, 0x50, 0x10, 0x50, 0x11, 0x41, 0x20, 0x40, 0x20, 0x40, 0x30,
+    0x07, 0x07, 0x33, 0x43, 0x24, 0x02, 0x00, 0x41, 0x90, 0x10, 0x41, 0x80, 0x10, 0x41, 0x80, 0x10,
+    0x30, 0x60, 0x80, 0x10, 0x30, 0x60, 0x80, 0x21, 0x61, 0x20, 0x70, 0x07, 0x07, 0x22, 0x12, 0x22,
+    0x02, 0x10, 0x50, 0x11, 0x41, 0x20, 0x40, 0x30, 0x20, 0x40, 0x11, 0x41, 0x10, 0x50, 0x07, 0x0A,
+    0x22, 0x22, 0x22, 0x11, 0x11, 0x00, 0x60, 0x10, 0x50, 0x10, 0x50, 0x11, 0x41, 0x20, 0x40, 0x20,
+    0x40, 0x30, 0x30, 0x20, 0x02, 0x07, 0x07, 0x11, 0x11, 0x11, 0x01, 0x13, 0x40, 0x30, 0x20, 0x20,
+    0x10, 0x14, 0x05, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x31, 0x20, 0x20, 0x20, 0x20, 0x01,
+    0x20, 0x20, 0x20, 0x20, 0x31, 0x04, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x05, 0x0B, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x20, 0x20, 0x20, 0x01, 0x09, 0x02,
+    0x11, 0x12, 0x42, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x02, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x02,
+};
+
+const SpanFont OpenSans_18_Regular_Spans = {
+    OpenSans_18_Regular,
+    0x20,
+    0x7F,
+    0x12,
+    OpenSans_18_Regular_Widths,
+    OpenSans_18_Regular_Offsets,
+    OpenSans_18_Regular_Data};
+
+// 96 glyphs: 1500 bytes of spans, 1515 bytes of packed bitmaps
+static const uint8_t OpenSans_15_Regular_Widths[] = {
+    0x02, 0x02, 0x03, 0x07, 0x06, 0x08, 0x07, 0x02, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x04,
+    0x05, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
+    0x09, 0x07, 0x06, 0x07, 0x07, 0x05, 0x06, 0x07, 0x07, 0x02, 0x02, 0x07, 0x06, 0x09, 0x07, 0x08,
+    0x06, 0x08, 0x06, 0x05, 0x06, 0x07, 0x07, 0x0A, 0x06, 0x06, 0x06, 0x04, 0x04, 0x03, 0x06, 0x05,
+    0x04, 0x05, 0x06, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x02, 0x02, 0x05, 0x02, 0x0A, 0x06, 0x06,
+    0x06, 0x06, 0x04, 0x05, 0x04, 0x06, 0x06, 0x09, 0x05, 0x06, 0x05, 0x04, 0x04, 0x03, 0x05, 0x03,
+};
+
+static const uint16_t OpenSans_15_Regular_Offsets[] = {
+    0x0000, 0x0002, 0x000F, 0x0014, 0x0026, 0x0038, 0x0054, 0x006A, 0x006F, 0x0080, 0x0091, 0x009C,
+    0x00A6, 0x00AD, 0x00B1, 0x00B5, 0x00C3, 0x00D7, 0x00E6, 0x00F4, 0x0103, 0x0114, 0x0122, 0x0133,
+    0x0141, 0x0154, 0x0165, 0x016C, 0x0176, 0x0181, 0x0187, 0x0192, 0x019E, 0x01BB, 0x01CF, 0x01E2,
+    0x01F0, 0x0204, 0x0212, 0x0220, 0x0231, 0x0246, 0x0254, 0x0265, 0x027A, 0x0288, 0x02A5, 0x02BF,
+    0x02D3, 0x02E4, 0x02FB, 0x030F, 0x031D, 0x032B, 0x0340, 0x0355, 0x0373, 0x0386, 0x0397, 0x03A5,
+    0x03B6, 0x03C4, 0x03D5, 0x03E2, 0x03E6, 0x03EB, 0x03F8, 0x040A, 0x0415, 0x0427, 0x0433, 0x0441,
+    0x0455, 0x0468, 0x0475, 0x0487, 0x049A, 0x04A8, 0x04BE, 0x04CE, 0x04DD, 0x04F1, 0x0505, 0x0510,
+    0x051B, 0x0528, 0x0538, 0x0547, 0x0560, 0x056F, 0x0583, 0x058E, 0x059F, 0x05B2, 0x05C3, 0x05C8,
+};
+
+static const uint8_t OpenSans_15_Regular_Data[] = {
+    0x0F, 0x00, 0x04, 0x08, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+    0x02, 0x11, 0x11, 0x11, 0x04, 0x08, 0x21, 0x21, 0x12, 0x12, 0x50, 0x20, 0x50, 0x15, 0x20, 0x40,
+    0x20, 0x40, 0x05, 0x10, 0x40, 0x10, 0x04, 0x08, 0x11, 0x22, 0x21, 0x12, 0x30, 0x23, 0x10, 0x30,
+    0x10, 0x30, 0x13, 0x30, 0x50, 0x30, 0x50, 0x13, 0x04, 0x08, 0x32, 0x33, 0x33, 0x23, 0x11, 0x60,
+    0x10, 0x30, 0x50, 0x10, 0x30, 0x50, 0x10, 0x31, 0x61, 0x11, 0x41, 0x70, 0x30, 0x50, 0x70, 0x30,
+    0x50, 0x70, 0x20, 0x61, 0x04, 0x08, 0x21, 0x12, 0x33, 0x22, 0x22, 0x10, 0x40, 0x10, 0x40, 0x21,
+    0x10, 0x30, 0x60, 0x10, 0x40, 0x60, 0x10, 0x50, 0x13, 0x60, 0x04, 0x02, 0x11, 0x10, 0x10, 0x04,
+    0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+    0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10,
+    0x10, 0x04, 0x05, 0x11, 0x11, 0x02, 0x20, 0x20, 0x05, 0x21, 0x10, 0x40, 0x06, 0x05, 0x11, 0x11,
+    0x01, 0x30, 0x30, 0x14, 0x30, 0x30, 0x0B, 0x03, 0x11, 0x01, 0x10, 0x10, 0x00, 0x09, 0x01, 0x01,
+    0x11, 0x0B, 0x01, 0x01, 0x10, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x30, 0x20, 0x20, 0x20, 0x10,
+    0x10, 0x10, 0x00, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x21, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x21, 0x04, 0x08, 0x21, 0x11, 0x11, 0x11, 0x21, 0x10, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x12, 0x40, 0x40, 0x40,
+    0x30, 0x20, 0x10, 0x13, 0x04, 0x08, 0x11, 0x11, 0x11, 0x12, 0x13, 0x40, 0x40, 0x21, 0x40, 0x40,
+    0x00, 0x40, 0x12, 0x04, 0x08, 0x11, 0x22, 0x12, 0x11, 0x31, 0x31, 0x20, 0x40, 0x10, 0x40, 0x10,
+    0x40, 0x05, 0x40, 0x40, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x13, 0x10, 0x10, 0x13, 0x40, 0x40,
+    0x40, 0x12, 0x04, 0x08, 0x11, 0x11, 0x22, 0x12, 0x22, 0x10, 0x10, 0x13, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x22, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x04, 0x40, 0x40, 0x30, 0x30, 0x20, 0x20,
+    0x20, 0x04, 0x08, 0x21, 0x12, 0x22, 0x12, 0x13, 0x10, 0x40, 0x10, 0x40, 0x21, 0x10, 0x40, 0x10,
+    0x40, 0x10, 0x40, 0x13, 0x04, 0x08, 0x21, 0x22, 0x11, 0x11, 0x12, 0x10, 0x40, 0x10, 0x40, 0x10,
+    0x40, 0x13, 0x40, 0x40, 0x12, 0x06, 0x06, 0x01, 0x00, 0x10, 0x10, 0x10, 0x06, 0x08, 0x01, 0x00,
+    0x10, 0x11, 0x10, 0x10, 0x10, 0x00, 0x05, 0x06, 0x11, 0x11, 0x11, 0x40, 0x30, 0x11, 0x10, 0x21,
+    0x40, 0x07, 0x03, 0x01, 0x01, 0x13, 0x13, 0x05, 0x06, 0x11, 0x11, 0x11, 0x10, 0x20, 0x31, 0x40,
+    0x21, 0x10, 0x04, 0x08, 0x11, 0x11, 0x01, 0x10, 0x03, 0x40, 0x40, 0x30, 0x20, 0x11, 0x04, 0x09,
+    0x21, 0x43, 0x44, 0x12, 0x01, 0x34, 0x20, 0x80, 0x10, 0x42, 0x80, 0x10, 0x30, 0x60, 0x80, 0x10,
+    0x30, 0x60, 0x80, 0x10, 0x30, 0x60, 0x80, 0x10, 0x35, 0x10, 0x24, 0x04, 0x08, 0x21, 0x22, 0x12,
+    0x22, 0x30, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x10, 0x50, 0x14, 0x10, 0x50, 0x00, 0x60, 0x04,
+    0x08, 0x21, 0x12, 0x22, 0x12, 0x14, 0x10, 0x50, 0x10, 0x50, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10,
+    0x50, 0x14, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x23, 0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x23,
+    0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x14, 0x10, 0x51, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10,
+    0x60, 0x10, 0x51, 0x14, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x13, 0x10, 0x10, 0x13, 0x10, 0x10,
+    0x10, 0x13, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x14, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10,
+    0x04, 0x08, 0x11, 0x11, 0x22, 0x12, 0x33, 0x11, 0x10, 0x10, 0x10, 0x51, 0x10, 0x60, 0x11, 0x60,
+    0x24, 0x04, 0x08, 0x22, 0x12, 0x22, 0x22, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x15, 0x10, 0x60,
+    0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x00, 0x04, 0x08, 0x22, 0x12, 0x22, 0x22, 0x10, 0x50, 0x10, 0x40, 0x10,
+    0x31, 0x12, 0x10, 0x30, 0x10, 0x40, 0x10, 0x50, 0x10, 0x60, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x04, 0x08, 0x22, 0x42, 0x34, 0x33, 0x11, 0x71,
+    0x11, 0x71, 0x11, 0x71, 0x10, 0x30, 0x60, 0x80, 0x10, 0x30, 0x60, 0x80, 0x10, 0x41, 0x80, 0x10,
+    0x41, 0x80, 0x10, 0x41, 0x80, 0x04, 0x08, 0x22, 0x33, 0x33, 0x22, 0x10, 0x60, 0x11, 0x60, 0x10,
+    0x30, 0x60, 0x10, 0x30, 0x60, 0x10, 0x40, 0x60, 0x10, 0x40, 0x60, 0x10, 0x51, 0x10, 0x60, 0x04,
+    0x08, 0x21, 0x22, 0x22, 0x12, 0x24, 0x11, 0x61, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70,
+    0x11, 0x61, 0x24, 0x04, 0x08, 0x21, 0x22, 0x11, 0x11, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50,
+    0x13, 0x10, 0x10, 0x10, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x12, 0x11, 0x24, 0x11, 0x61, 0x10, 0x70,
+    0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x11, 0x61, 0x24, 0x50, 0x60, 0x04, 0x08, 0x21, 0x22, 0x21,
+    0x22, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x13, 0x10, 0x40, 0x10, 0x50, 0x10, 0x50, 0x04,
+    0x08, 0x11, 0x11, 0x11, 0x11, 0x22, 0x10, 0x10, 0x11, 0x31, 0x40, 0x40, 0x12, 0x04, 0x08, 0x11,
+    0x11, 0x11, 0x11, 0x14, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x04, 0x08, 0x22, 0x22, 0x22,
+    0x12, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x23,
+    0x04, 0x08, 0x22, 0x22, 0x22, 0x12, 0x00, 0x60, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x20, 0x40,
+    0x20, 0x40, 0x20, 0x40, 0x30, 0x04, 0x08, 0x33, 0x43, 0x34, 0x22, 0x00, 0x41, 0x90, 0x00, 0x41,
+    0x80, 0x10, 0x41, 0x80, 0x10, 0x30, 0x60, 0x80, 0x10, 0x30, 0x60, 0x80, 0x10, 0x30, 0x61, 0x21,
+    0x61, 0x20, 0x70, 0x04, 0x08, 0x22, 0x11, 0x21, 0x22, 0x00, 0x50, 0x10, 0x40, 0x21, 0x21, 0x21,
+    0x10, 0x40, 0x10, 0x40, 0x00, 0x50, 0x04, 0x08, 0x22, 0x12, 0x11, 0x11, 0x00, 0x50, 0x10, 0x40,
+    0x10, 0x40, 0x21, 0x21, 0x30, 0x30, 0x30, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x13, 0x40, 0x30,
+    0x30, 0x20, 0x10, 0x10, 0x05, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x12, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x00, 0x10, 0x10, 0x10,
+    0x20, 0x20, 0x20, 0x30, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x02, 0x04, 0x05, 0x11, 0x22, 0x02, 0x20, 0x21, 0x10, 0x40, 0x10, 0x40,
+    0x00, 0x50, 0x0D, 0x01, 0x01, 0x04, 0x03, 0x02, 0x11, 0x20, 0x30, 0x06, 0x06, 0x11, 0x21, 0x12,
+    0x13, 0x40, 0x13, 0x10, 0x40, 0x10, 0x40, 0x13, 0x04, 0x08, 0x11, 0x21, 0x22, 0x12, 0x10, 0x10,
+    0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x13, 0x06, 0x06, 0x11, 0x11, 0x11, 0x22,
+    0x10, 0x10, 0x10, 0x10, 0x22, 0x04, 0x08, 0x11, 0x21, 0x22, 0x12, 0x50, 0x50, 0x23, 0x10, 0x50,
+    0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x23, 0x06, 0x06, 0x21, 0x11, 0x11, 0x22, 0x10, 0x40, 0x13,
+    0x10, 0x10, 0x22, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x21, 0x10, 0x03, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x06, 0x09, 0x21, 0x12, 0x11, 0x22, 0x01, 0x14, 0x10, 0x40, 0x10, 0x40, 0x12, 0x10, 0x13,
+    0x00, 0x50, 0x00, 0x41, 0x13, 0x04, 0x08, 0x11, 0x21, 0x22, 0x22, 0x10, 0x10, 0x13, 0x10, 0x50,
+    0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x04, 0x08, 0x01, 0x11, 0x11, 0x11, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x0B, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x04, 0x08, 0x11, 0x22, 0x21, 0x22, 0x10, 0x10, 0x10,
+    0x40, 0x10, 0x30, 0x11, 0x10, 0x30, 0x10, 0x40, 0x10, 0x40, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x06, 0x06, 0x32, 0x33, 0x33, 0x13, 0x63, 0x10,
+    0x50, 0x90, 0x10, 0x50, 0x90, 0x10, 0x50, 0x90, 0x10, 0x50, 0x90, 0x10, 0x50, 0x90, 0x06, 0x06,
+    0x21, 0x22, 0x22, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x06, 0x06,
+    0x21, 0x22, 0x12, 0x22, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x22, 0x06, 0x09, 0x21,
+    0x22, 0x12, 0x11, 0x01, 0x13, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x13, 0x10, 0x10,
+    0x10, 0x06, 0x09, 0x21, 0x22, 0x12, 0x11, 0x01, 0x23, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10,
+    0x50, 0x23, 0x50, 0x50, 0x50, 0x06, 0x06, 0x11, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x06, 0x06, 0x11, 0x11, 0x11, 0x22, 0x10, 0x20, 0x30, 0x40, 0x12, 0x05, 0x07, 0x11, 0x11, 0x11,
+    0x01, 0x10, 0x03, 0x10, 0x10, 0x10, 0x10, 0x12, 0x06, 0x06, 0x22, 0x22, 0x12, 0x10, 0x50, 0x10,
+    0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x14, 0x06, 0x06, 0x22, 0x22, 0x11, 0x00, 0x50, 0x10,
+    0x40, 0x10, 0x40, 0x10, 0x40, 0x21, 0x21, 0x06, 0x06, 0x43, 0x44, 0x23, 0x00, 0x40, 0x80, 0x10,
+    0x30, 0x50, 0x70, 0x10, 0x30, 0x50, 0x70, 0x10, 0x30, 0x50, 0x70, 0x11, 0x50, 0x70, 0x20, 0x60,
+    0x06, 0x06, 0x22, 0x11, 0x22, 0x10, 0x40, 0x10, 0x40, 0x21, 0x21, 0x10, 0x40, 0x10, 0x40, 0x06,
+    0x09, 0x22, 0x22, 0x11, 0x11, 0x01, 0x00, 0x50, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x21, 0x21,
+    0x20, 0x20, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x13, 0x30, 0x20, 0x20, 0x10, 0x04, 0x04, 0x0A,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x20, 0x20, 0x20, 0x10, 0x10, 0x20, 0x20, 0x20, 0x21, 0x04,
+    0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x10, 0x10, 0x20, 0x20, 0x10,
+    0x10, 0x10, 0x01, 0x07, 0x02, 0x11, 0x11, 0x31, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x02, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x02,
+};
+
+const SpanFont OpenSans_15_Regular_Spans = {
+    OpenSans_15_Regular,
+    0x20,
+    0x7F,
+    0x0F,
+    OpenSans_15_Regular_Widths,
+    OpenSans_15_Regular_Offsets,
+    OpenSans_15_Regular_Data};
+
+const SpanFont *const SpanFonts[] = {
+    &OpenSans_18_Regular_Spans,
+    &OpenSans_15_Regular_Spans,
+};
+
+const uint8_t SpanFontsCount = sizeof(SpanFonts) / sizeof(SpanFonts[0]);
+
+#endif // OLED_SPAN_FONTS
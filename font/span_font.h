@@ -0,0 +1,43 @@
+/** Span Font
+ *  This file contains the span-encoded font format.
+ *
+ *  Span fonts are generated from the Hexiwear fonts by the font compiler
+ *  in host/font_compiler.cpp. Each glyph is stored as horizontal runs of
+ *  lit pixels so the renderer fills whole runs instead of testing bits.
+ *
+ *  Glyph record layout:
+ *    [top] [rows] [span count of each row, 4 bits each, LSB first]
+ *    [spans, one byte each: (x << 4) | (length - 1)]
+ *  Rows before top and after top + rows are empty.
+ */
+
+#ifndef SPAN_FONT_H_
+#define SPAN_FONT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  typedef struct
+  {
+    const uint8_t *source;   // Hexiwear font this font was generated from
+    uint16_t firstChar;      // first character in the font
+    uint16_t lastChar;       // last character in the font
+    uint8_t height;          // height of every glyph
+    const uint8_t *widths;   // width of each glyph
+    const uint16_t *offsets; // offset of each glyph record in data
+    const uint8_t *data;     // glyph records
+  } SpanFont;
+
+  // All the span fonts compiled in
+  extern const SpanFont *const SpanFonts[];
+  extern const uint8_t SpanFontsCount;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPAN_FONT_H_
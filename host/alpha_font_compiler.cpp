@@ -0,0 +1,392 @@
+/** OLED Alpha Font Compiler
+ *  This file contains the host tool that adds an alpha plane to the
+ *  Hexiwear fonts, in the format described in font/alpha_font.h.
+ *
+ *  The coverage of each glyph is read from a binary PGM (P5) strip with
+ *  the glyphs side by side at their Hexiwear widths, rendered from the
+ *  original typeface at the same size. Fonts without a strip get their
+ *  coverage from the 1-bit bitmap: lit pixels stay opaque and the unlit
+ *  pixels along the edges get a partial alpha from their lit neighbours.
+ *
+ *  Every glyph is decoded back after encoding and compared against the
+ *  quantized coverage; the tool fails if they differ.
+ *
+ *  The host build makes it as alpha_font_compiler; run it from the
+ *  repository root:
+ *    _build/host/alpha_font_compiler [--bpp 2|4] [--strip FONT_NAME=coverage.pgm]... > font/opensans_alpha_font.c
+ *
+ *  The shipped font/opensans_alpha_font.c was generated without strips,
+ *  so its coverage comes from the 1-bit edges.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "opensans_font.h"
+
+struct FontEntry
+{
+  const char *name;
+  const uint8_t *font;
+};
+
+static const FontEntry fonts[] = {
+    {"OpenSans_18_Regular", OpenSans_18_Regular},
+    {"OpenSans_15_Regular", OpenSans_15_Regular},
+};
+
+// Coverage strip of a font: one byte per pixel, 0 to 255
+struct Strip
+{
+  std::string font;
+  uint32_t width;
+  uint32_t height;
+  std::vector<uint8_t> pixels;
+};
+
+// Read the next number of a PGM header, skipping blanks and comments
+// Print to the output with CRLF line endings, as in the rest of the tree
+static void emit(const char *format, ...)
+{
+  char text[512];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  for (const char *c = text; *c != 0; c++)
+  {
+    if (*c == '\n')
+    {
+      putchar('\r');
+    }
+    putchar(*c);
+  }
+}
+
+static bool read_pgm_number(FILE *f, uint32_t *value)
+{
+  int c = fgetc(f);
+  while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#')
+  {
+    if (c == '#')
+    {
+      while (c != '\n' && c != EOF)
+      {
+        c = fgetc(f);
+      }
+    }
+    c = fgetc(f);
+  }
+  if (c < '0' || c > '9')
+  {
+    return false;
+  }
+  *value = 0;
+  while (c >= '0' && c <= '9')
+  {
+    *value = *value * 10 + (c - '0');
+    c = fgetc(f);
+  }
+  return true;
+}
+
+static bool load_strip(const char *path, Strip *strip)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    fprintf(stderr, "%s: cannot open\n", path);
+    return false;
+  }
+
+  uint32_t maxValue = 0;
+  bool ok = fgetc(f) == 'P' && fgetc(f) == '5' &&
+            read_pgm_number(f, &strip->width) &&
+            read_pgm_number(f, &strip->height) &&
+            read_pgm_number(f, &maxValue) &&
+            maxValue > 0 && maxValue < 256;
+  if (ok)
+  {
+    strip->pixels.resize(strip->width * strip->height);
+    ok = fread(strip->pixels.data(), 1, strip->pixels.size(), f) == strip->pixels.size();
+    for (uint8_t &p : strip->pixels)
+    {
+      p = (uint8_t)(p * 255 / maxValue);
+    }
+  }
+  fclose(f);
+
+  if (!ok)
+  {
+    fprintf(stderr, "%s: not a binary PGM\n", path);
+  }
+  return ok;
+}
+
+// Decode a glyph from the packed Hexiwear bitmap
+static std::vector<uint8_t> decode_bitmap(const uint8_t *bitmap, uint8_t width, uint8_t height)
+{
+  std::vector<uint8_t> pixels(width * height);
+  uint8_t foo = 0, mask;
+  for (uint8_t y = 0; y < height; y++)
+  {
+    mask = 0;
+    for (uint8_t x = 0; x < width; x++)
+    {
+      if (mask == 0)
+      {
+        mask = 1;
+        foo = *bitmap++;
+      }
+      pixels[y * width + x] = (foo & mask) != 0;
+      mask <<= 1;
+    }
+  }
+  return pixels;
+}
+
+// Derive the coverage of a glyph from its 1-bit bitmap
+static std::vector<uint8_t> smooth_bitmap(const std::vector<uint8_t> &bits, uint8_t width, uint8_t height)
+{
+  std::vector<uint8_t> coverage(width * height);
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      if (bits[y * width + x])
+      {
+        coverage[y * width + x] = 255;
+        continue;
+      }
+
+      // side neighbours weigh twice the corner ones; at most half opaque
+      int weight = 0;
+      for (int dy = -1; dy <= 1; dy++)
+      {
+        for (int dx = -1; dx <= 1; dx++)
+        {
+          int nx = x + dx, ny = y + dy;
+          if ((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= width || ny >= height)
+          {
+            continue;
+          }
+          if (bits[ny * width + nx])
+          {
+            weight += (dx == 0 || dy == 0) ? 2 : 1;
+          }
+        }
+      }
+      coverage[y * width + x] = (uint8_t)(weight * 255 / 24);
+    }
+  }
+  return coverage;
+}
+
+// Pack the quantized coverage of a glyph into an alpha plane
+static std::vector<uint8_t> encode_plane(const std::vector<uint8_t> &levels, uint8_t width, uint8_t height, uint8_t bpp)
+{
+  std::vector<uint8_t> plane;
+  for (uint8_t y = 0; y < height; y++)
+  {
+    uint8_t byte = 0, shift = 0;
+    for (uint8_t x = 0; x < width; x++)
+    {
+      byte |= levels[y * width + x] << shift;
+      shift += bpp;
+      if (shift == 8)
+      {
+        plane.push_back(byte);
+        byte = 0;
+        shift = 0;
+      }
+    }
+    if (shift != 0)
+    {
+      plane.push_back(byte);
+    }
+  }
+  return plane;
+}
+
+// Decode an alpha plane, the same way the driver does
+static std::vector<uint8_t> decode_plane(const uint8_t *plane, uint8_t width, uint8_t height, uint8_t bpp)
+{
+  std::vector<uint8_t> levels(width * height);
+  uint8_t max = (1 << bpp) - 1;
+  for (uint8_t y = 0; y < height; y++)
+  {
+    uint8_t bits = 0, left = 0;
+    for (uint8_t x = 0; x < width; x++)
+    {
+      if (left == 0)
+      {
+        bits = *plane++;
+        left = 8;
+      }
+      levels[y * width + x] = bits & max;
+      bits >>= bpp;
+      left -= bpp;
+    }
+  }
+  return levels;
+}
+
+static bool compile_font(const FontEntry &entry, uint8_t bpp, const Strip *strip)
+{
+  const uint8_t *font = entry.font;
+  uint16_t firstChar = font[2] | ((uint16_t)font[3] << 8);
+  uint16_t lastChar = font[4] | ((uint16_t)font[5] << 8);
+  uint8_t height = font[6];
+  uint16_t glyphs = lastChar - firstChar + 1;
+  uint8_t max = (1 << bpp) - 1;
+
+  std::vector<uint16_t> offsets;
+  std::vector<uint8_t> data;
+  uint32_t stripX = 0;
+
+  if (strip != NULL && strip->height != height)
+  {
+    fprintf(stderr, "%s: the strip is %u pixels high, the font %u\n", entry.name, strip->height, height);
+    return false;
+  }
+
+  for (uint16_t i = 0; i < glyphs; i++)
+  {
+    const uint8_t *charOffsetTable = font + 8 + (i << 2);
+    uint8_t width = charOffsetTable[0];
+    uint32_t offset = (uint32_t)charOffsetTable[1] |
+                      ((uint32_t)charOffsetTable[2] << 8) |
+                      ((uint32_t)charOffsetTable[3] << 16);
+
+    std::vector<uint8_t> coverage;
+    if (strip != NULL)
+    {
+      if (stripX + width > strip->width)
+      {
+        fprintf(stderr, "%s: the strip is too narrow for glyph %u\n", entry.name, firstChar + i);
+        return false;
+      }
+      coverage.resize(width * height);
+      for (uint8_t y = 0; y < height; y++)
+      {
+        memcpy(&coverage[y * width], &strip->pixels[y * strip->width + stripX], width);
+      }
+      stripX += width;
+    }
+    else
+    {
+      coverage = smooth_bitmap(decode_bitmap(font + offset, width, height), width, height);
+    }
+
+    std::vector<uint8_t> levels(width * height);
+    for (size_t p = 0; p < levels.size(); p++)
+    {
+      levels[p] = (uint8_t)((coverage[p] * max + 127) / 255);
+    }
+
+    std::vector<uint8_t> plane = encode_plane(levels, width, height, bpp);
+    if (decode_plane(plane.data(), width, height, bpp) != levels)
+    {
+      fprintf(stderr, "%s: glyph %u does not round-trip\n", entry.name, firstChar + i);
+      return false;
+    }
+    if (data.size() + plane.size() > 0xFFFF)
+    {
+      fprintf(stderr, "%s: too much data for 16-bit offsets\n", entry.name);
+      return false;
+    }
+
+    offsets.push_back((uint16_t)data.size());
+    data.insert(data.end(), plane.begin(), plane.end());
+  }
+
+  emit("// %u glyphs: %u bytes of %u-bit alpha planes, %s\n", glyphs, (unsigned)data.size(), bpp,
+       strip != NULL ? "coverage from a strip" : "coverage derived from the bitmap");
+  emit("static const uint16_t %s_AlphaOffsets[] = {", entry.name);
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    emit("%s0x%04X,", (i % 12) ? " " : "\n    ", offsets[i]);
+  }
+  emit("\n};\n\n");
+  emit("static const uint8_t %s_AlphaData[] = {", entry.name);
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    emit("%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+  }
+  emit("\n};\n\n");
+  emit("const AlphaFont %s_Alpha = {\n", entry.name);
+  emit("    %s,\n    %u,\n", entry.name, bpp);
+  emit("    %s_AlphaOffsets,\n    %s_AlphaData};\n\n", entry.name, entry.name);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  uint8_t bpp = 4;
+  std::vector<Strip> strips;
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    if (strcmp(argv[i], "--bpp") == 0)
+    {
+      bpp = (uint8_t)atoi(argv[i + 1]);
+    }
+    else if (strcmp(argv[i], "--strip") == 0)
+    {
+      const char *eq = strchr(argv[i + 1], '=');
+      Strip strip;
+      if (eq == NULL)
+      {
+        fprintf(stderr, "--strip wants FONT_NAME=coverage.pgm\n");
+        return 1;
+      }
+      strip.font.assign(argv[i + 1], eq - argv[i + 1]);
+      if (!load_strip(eq + 1, &strip))
+      {
+        return 1;
+      }
+      strips.push_back(strip);
+    }
+  }
+  if (bpp != 2 && bpp != 4)
+  {
+    fprintf(stderr, "usage: %s [--bpp 2|4] [--strip FONT_NAME=coverage.pgm]...\n", argv[0]);
+    return 1;
+  }
+
+  emit("/** OpenSans Alpha Font\n");
+  emit(" *  This file contains the anti-aliased version of the OpenSans fonts.\n");
+  emit(" *\n");
+  emit(" *  Generated by host/alpha_font_compiler.cpp, do not edit.\n");
+  emit(" */\n\n");
+  emit("#include \"opensans_font.h\"\n");
+  emit("#include \"alpha_font.h\"\n\n");
+
+  for (const FontEntry &entry : fonts)
+  {
+    const Strip *strip = NULL;
+    for (const Strip &s : strips)
+    {
+      if (s.font == entry.name)
+      {
+        strip = &s;
+      }
+    }
+    if (!compile_font(entry, bpp, strip))
+    {
+      return 1;
+    }
+  }
+
+  emit("const AlphaFont *const AlphaFonts[] = {\n");
+  for (const FontEntry &entry : fonts)
+  {
+    emit("    &%s_Alpha,\n", entry.name);
+  }
+  emit("};\n\n");
+  emit("const uint8_t AlphaFontsCount = sizeof(AlphaFonts) / sizeof(AlphaFonts[0]);\n");
+  return 0;
+}
@@ -0,0 +1,173 @@
+/** Alpha Font Test
+ *  This file contains the host test of the anti-aliased text.
+ *
+ *  The test brings its own alpha fonts in place of the generated ones.
+ *  The OpenSans fonts get full-coverage planes, opaque where the bitmap
+ *  is lit and transparent elsewhere, so every glyph must come out of the
+ *  blend kernel the same as from the 1-bit path. A copy of OpenSans 15
+ *  gets the unlit pixels of its glyphs at partial coverage, and each of
+ *  them must be the blend of the font and the background colors.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "oled_ssd1351.h"
+#include "opensans_font.h"
+#include "alpha_font.h"
+#include "font_walk.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+// coverage of the unlit pixels of the copy, out of 15
+#define PARTIAL_LEVEL (6)
+
+struct TestFont
+{
+  AlphaFont alpha;
+  std::vector<uint16_t> offsets;
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> source;
+};
+
+static TestFont font18, font15, fontCopy;
+
+extern "C" const AlphaFont *const AlphaFonts[] = {&font18.alpha, &font15.alpha, &fontCopy.alpha};
+extern "C" const uint8_t AlphaFontsCount = 3;
+
+// Build the alpha planes of a font: lit pixels are opaque, the others
+// take the given level
+static void build_font(TestFont *test, const uint8_t *font, uint8_t bpp, uint8_t unlitLevel)
+{
+  uint8_t height = font_height(font);
+  uint8_t opaque = (1 << bpp) - 1;
+  for (uint16_t i = 0; i < font_glyph_count(font); i++)
+  {
+    uint8_t width = font_glyph_width(font, i);
+    const uint8_t *bitmap = font + font_glyph_offset(font, i);
+    test->offsets.push_back((uint16_t)test->data.size());
+    for (uint8_t y = 0; y < height; y++)
+    {
+      uint8_t bits = 0, used = 0;
+      for (uint8_t x = 0; x < width; x++)
+      {
+        bool lit = (bitmap[x >> 3] >> (x & 7)) & 1;
+        bits |= (lit ? opaque : unlitLevel) << used;
+        used += bpp;
+        if (used == 8)
+        {
+          test->data.push_back(bits);
+          bits = 0;
+          used = 0;
+        }
+      }
+      if (used > 0)
+      {
+        test->data.push_back(bits);
+      }
+      bitmap += (width + 7) >> 3;
+    }
+  }
+  test->alpha.source = font;
+  test->alpha.bpp = bpp;
+  test->alpha.offsets = test->offsets.data();
+  test->alpha.data = test->data.data();
+}
+
+// Check that a channel is the blend of the font and background ones;
+// the driver rounds the coverage to 1/32 steps and truncates the blend
+static bool channel_blended(uint32_t value, uint32_t fg, uint32_t bg, uint8_t level, uint8_t opaque)
+{
+  double expected = bg + ((double)fg - bg) * level / opaque;
+  return fabs(value - expected) < 2.0;
+}
+
+static bool pixel_blended(pixel_t value, pixel_t fg, pixel_t bg, uint8_t level, uint8_t opaque)
+{
+  return channel_blended(value >> 11, fg >> 11, bg >> 11, level, opaque) &&
+         channel_blended((value >> 5) & 0x3F, (fg >> 5) & 0x3F, (bg >> 5) & 0x3F, level, opaque) &&
+         channel_blended(value & 0x1F, fg & 0x1F, bg & 0x1F, level, opaque);
+}
+
+static uint32_t check_font(const TestFont *test, bool partial, Color fg, Color bg)
+{
+  const uint8_t *font = test->alpha.source;
+  uint16_t firstChar = font_first_char(font);
+  uint8_t height = font_height(font);
+  uint8_t opaque = (1 << test->alpha.bpp) - 1;
+
+  SSD1351Emulator blendScreen, bitScreen;
+  SSD1351 blendOled(&blendScreen);
+  SSD1351 bitOled(&bitScreen);
+  blendOled.set_text_antialiasing(true);
+
+  TextProperties prop;
+  blendOled.get_text_properties(&prop);
+  prop.font = font;
+  prop.fontColor = fg;
+  blendOled.set_text_properties(&prop);
+  bitOled.set_text_properties(&prop);
+
+  uint32_t failures = 0;
+  for (uint16_t i = 0; i < font_glyph_count(font); i++)
+  {
+    char text[2] = {(char)(firstChar + i), 0};
+    uint8_t width = font_glyph_width(font, i);
+    blendOled.fill_screen(bg);
+    bitOled.fill_screen(bg);
+    blendOled.label(text, 3, 5);
+    bitOled.label(text, 3, 5);
+
+    for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+    {
+      for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+      {
+        pixel_t blended = blendScreen.pixel(x, y);
+        pixel_t bit = bitScreen.pixel(x, y);
+        bool inGlyph = x >= 3 && x < 3 + width && y >= 5 && y < 5 + height;
+        bool ok;
+        if (!partial || !inGlyph || bit == (pixel_t)fg)
+        {
+          ok = blended == bit;
+        }
+        else
+        {
+          ok = pixel_blended(blended, fg, bg, PARTIAL_LEVEL, opaque);
+        }
+        if (!ok)
+        {
+          printf("glyph 0x%02X: pixel %u,%u is 0x%04X, 1-bit 0x%04X\n", firstChar + i, x, y, blended, bit);
+          failures++;
+          y = OLED_SCREEN_HEIGHT - 1;
+          break;
+        }
+      }
+    }
+  }
+  return failures;
+}
+
+int main()
+{
+  fontCopy.source = copy_font(OpenSans_15_Regular);
+  build_font(&font18, OpenSans_18_Regular, 4, 0);
+  build_font(&font15, OpenSans_15_Regular, 2, 0);
+  build_font(&fontCopy, fontCopy.source.data(), 4, PARTIAL_LEVEL);
+
+  const Color colors[][2] = {
+      {Color::WHITE, Color::BLACK},
+      {(Color)0x07E0, (Color)0x8010},
+      {(Color)0x1234, (Color)0xFEDC},
+  };
+
+  uint32_t failures = 0;
+  for (const auto &c : colors)
+  {
+    failures += check_font(&font18, false, c[0], c[1]);
+    failures += check_font(&font15, false, c[0], c[1]);
+    failures += check_font(&fontCopy, true, c[0], c[1]);
+  }
+  printf("%u glyphs failed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,251 @@
+/** Animator Test
+ *  This file contains the host test of the animator.
+ *
+ *  The animator runs on a clock the test moves by hand, and a test step
+ *  takes a set time to draw each frame. The frames must come at the
+ *  frame rate, a frame that runs over its budget must be merged with the
+ *  ones it overlaps, and the last frame must get the full progress once.
+ *  The clock starts just before it wraps around. The slide steps are
+ *  then checked halfway and at the end against the image, and the dim
+ *  fade must take the master contrast down one level at a time and back.
+ */
+
+#include <stdio.h>
+#include "oled_animator.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+#define FPS (30)
+#define FRAME_US (1000000 / FPS)
+#define DRAW_US (3000)
+#define OVERRUN_FRAME (5)
+#define OVERRUN_US (120000)
+#define DURATION_MS (1000)
+
+static uint32_t now;
+static uint32_t clock_us()
+{
+  return now;
+}
+
+struct StepLog
+{
+  uint32_t calls;
+  uint16_t lastProgress;
+  uint32_t lastProgressCalls; // calls with the full progress
+  bool backwards;             // progress went down
+};
+
+static void step_test(SSD1351 *, void *context, uint32_t, uint16_t progress)
+{
+  StepLog *log = (StepLog *)context;
+  log->calls++;
+  if (progress < log->lastProgress)
+  {
+    log->backwards = true;
+  }
+  log->lastProgress = progress;
+  log->lastProgressCalls += progress == OLED_ANIMATION_PROGRESS_MAX;
+  now += log->calls == OVERRUN_FRAME ? OVERRUN_US : DRAW_US;
+}
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("%s: FAILED\n", what);
+    failures++;
+  }
+}
+
+static void check_pacing()
+{
+  SSD1351Emulator screen;
+  SSD1351 oled(&screen);
+  Animator animator(&oled, FPS, clock_us);
+  StepLog log = {0, 0, 0, false};
+  Animation animation = {step_test, &log, DURATION_MS, 0, false};
+
+  now = 0xFFFFFFFF - 50000;
+  animator.start(&animation);
+
+  // the first frame is drawn at once, the next one is a frame later
+  uint32_t wait = animator.tick();
+  check(log.calls == 1 && wait == FRAME_US - DRAW_US, "first frame");
+
+  // a tick before the frame is due draws nothing
+  now += wait - 1000;
+  wait = animator.tick();
+  check(log.calls == 1 && wait == 1000, "early tick");
+
+  uint32_t ticks = 0;
+  while (animator.is_running(&animation) && ticks < 1000)
+  {
+    now += wait;
+    bool onTime = wait > 0;
+    uint32_t calls = log.calls;
+    wait = animator.tick();
+    ticks++;
+
+    // a frame drawn when due leaves the rest of its budget; the one after
+    // the overrun is late, and the next frame stays on the frame grid
+    if (onTime && log.calls == calls + 1 && log.calls != OVERRUN_FRAME)
+    {
+      check(wait == FRAME_US - DRAW_US, "frame budget");
+    }
+  }
+
+  // the overrun lasts 3.6 frame periods: the three frames due during it
+  // are merged into the one drawn after it, so two are skipped
+  const AnimatorStats &stats = animator.stats();
+  check(!animator.is_running(&animation), "animation ended");
+  check(stats.skipped == 2, "skipped frames");
+  check(stats.frames == log.calls, "frame count");
+  // the last frame is the first one at or past the duration
+  check(stats.frames + stats.skipped == (DURATION_MS * 1000 + FRAME_US - 1) / FRAME_US + 1, "frame slots");
+  check(stats.maxFrameUs == OVERRUN_US && stats.lastFrameUs == DRAW_US, "frame times");
+  check(log.lastProgress == OLED_ANIMATION_PROGRESS_MAX && log.lastProgressCalls == 1, "last frame");
+  check(!log.backwards, "progress order");
+
+  // with nothing running, tick() only waits for the next frame
+  uint32_t frames = stats.frames;
+  now += animator.tick();
+  animator.tick();
+  check(animator.stats().frames == frames, "idle tick");
+
+  printf("%u frames, %u skipped\n", stats.frames, stats.skipped);
+}
+
+static void check_slide(Transition transition, const pixel_t *image, const char *name)
+{
+  SSD1351Emulator screen;
+  SSD1351 oled(&screen);
+  oled.fill_screen(Color::BLACK);
+  Animator animator(&oled, FPS, clock_us);
+  SlideAnimation slide = {(const uint8_t *)image, transition, 0};
+  Animation animation = {&Animator::step_slide, &slide, 600, 0, false};
+
+  now = 0;
+  animator.start(&animation);
+  bool halfway = false;
+  while (animator.is_running(&animation))
+  {
+    now += animator.tick();
+
+    if (halfway || now < 300000)
+    {
+      continue;
+    }
+    halfway = true;
+
+    // the far edge of the image is at the near edge of the screen
+    for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+    {
+      for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+      {
+        int shown = slide.shown;
+        int ix = x, iy = y;
+        bool in;
+        switch (transition)
+        {
+        case Transition::TOP_DOWN:
+          in = y < shown;
+          iy = OLED_SCREEN_HEIGHT - shown + y;
+          break;
+        case Transition::DOWN_TOP:
+          in = y >= OLED_SCREEN_HEIGHT - shown;
+          iy = y - (OLED_SCREEN_HEIGHT - shown);
+          break;
+        case Transition::LEFT_RIGHT:
+          in = x < shown;
+          ix = OLED_SCREEN_WIDTH - shown + x;
+          break;
+        default:
+          in = x >= OLED_SCREEN_WIDTH - shown;
+          ix = x - (OLED_SCREEN_WIDTH - shown);
+          break;
+        }
+        pixel_t expected = in ? (pixel_t)((image[iy * OLED_SCREEN_WIDTH + ix] >> 8) | (image[iy * OLED_SCREEN_WIDTH + ix] << 8))
+                              : (pixel_t)Color::BLACK;
+        if (screen.pixel(x, y) != expected)
+        {
+          printf("%s halfway, %d shown: pixel %u,%u differs\n", name, shown, x, y);
+          failures++;
+          y = OLED_SCREEN_HEIGHT - 1;
+          break;
+        }
+      }
+    }
+  }
+  check(halfway, name);
+
+  for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+    {
+      pixel_t pixel = image[y * OLED_SCREEN_WIDTH + x];
+      if (screen.pixel(x, y) != (pixel_t)((pixel >> 8) | (pixel << 8)))
+      {
+        printf("%s: pixel %u,%u differs at the end\n", name, x, y);
+        failures++;
+        return;
+      }
+    }
+  }
+}
+
+static void check_dim()
+{
+  SSD1351Emulator screen;
+  SSD1351 oled(&screen);
+  Animator animator(&oled, FPS, clock_us);
+  Animation animation;
+  ContrastFade fade;
+
+  for (int dim = 1; dim >= 0; dim--)
+  {
+    now = 0;
+    animator.dim_screen(&animation, &fade, dim);
+    Contrast contrast;
+    oled.get_contrast(&contrast);
+    uint8_t last = contrast.master;
+    bool steady = true;
+    while (animator.is_running(&animation))
+    {
+      now += animator.tick();
+      oled.get_contrast(&contrast);
+      steady &= dim ? contrast.master <= last : contrast.master >= last;
+      last = contrast.master;
+    }
+    check(steady && now >= OLED_DIM_FADE_MS * 1000, "dim fade");
+    check(contrast.master == (dim ? 0 : 0xF) && contrast.a == 0x8A && contrast.b == 0x51, "dim target");
+  }
+
+  // without a duration the contrast changes at once
+  Contrast contrast;
+  check(animator.dim_screen(&animation, &fade, true, 0) == Status::SUCCESS, "instant dim");
+  oled.get_contrast(&contrast);
+  check(contrast.master == 0 && !animator.is_running(&animation), "instant dim target");
+}
+
+int main()
+{
+  check_pacing();
+  check_dim();
+
+  static pixel_t image[OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT];
+  for (int i = 0; i < OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT; i++)
+  {
+    image[i] = (pixel_t)(i * 40503u) | 0x0101;
+  }
+  check_slide(Transition::TOP_DOWN, image, "TOP_DOWN");
+  check_slide(Transition::DOWN_TOP, image, "DOWN_TOP");
+  check_slide(Transition::LEFT_RIGHT, image, "LEFT_RIGHT");
+  check_slide(Transition::RIGHT_LEFT, image, "RIGHT_LEFT");
+
+  printf("%u failures\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,97 @@
+/** OLED Counting Transport
+ *  This file contains a host-side transport stub that counts the traffic
+ *  produced by the OLED driver without any hardware attached.
+ *
+ *  Use it to compare how many transport calls and bytes a drawing
+ *  operation costs, e.g. per-byte against bulk transfers.
+ */
+
+#ifndef OLED_COUNTING_TRANSPORT_H_
+#define OLED_COUNTING_TRANSPORT_H_
+
+#include "oled_transport.h"
+
+namespace oled
+{
+  // Traffic counters collected by CountingTransport
+  struct TransportStats
+  {
+    uint32_t selects;     // number of chip select assertions
+    uint32_t dcToggles;   // number of D/C line changes
+    uint32_t writeCalls;  // number of write() calls
+    uint32_t cmdBytes;    // bytes sent with D/C low
+    uint32_t dataBytes;   // bytes sent with D/C high
+  };
+
+  class CountingTransport : public Transport
+  {
+  public:
+    CountingTransport() : _data(false)
+    {
+      reset_stats();
+    }
+
+    void set_power(bool on) override
+    {
+      (void)on;
+    }
+
+    void set_reset(bool active) override
+    {
+      (void)active;
+    }
+
+    void sleep_ms(uint32_t ms) override
+    {
+      (void)ms;
+    }
+
+    void select() override
+    {
+      _stats.selects++;
+    }
+
+    void deselect() override {}
+
+    void set_data_mode(bool data) override
+    {
+      if (data != _data)
+      {
+        _stats.dcToggles++;
+      }
+      _data = data;
+    }
+
+    void write(const uint8_t *data, uint32_t size) override
+    {
+      (void)data;
+      _stats.writeCalls++;
+      if (_data)
+      {
+        _stats.dataBytes += size;
+      }
+      else
+      {
+        _stats.cmdBytes += size;
+      }
+    }
+
+    // Get the counters collected so far
+    const TransportStats &stats() const
+    {
+      return _stats;
+    }
+
+    // Reset all the counters to zero
+    void reset_stats()
+    {
+      _stats = TransportStats{0, 0, 0, 0, 0};
+    }
+
+  private:
+    bool _data;
+    TransportStats _stats;
+  };
+} // namespace oled
+
+#endif // OLED_COUNTING_TRANSPORT_H_
@@ -0,0 +1,55 @@
+/** OLED File Image Source
+ *  This file contains a host-side image source that reads raw pixels
+ *  from a file.
+ */
+
+#ifndef OLED_FILE_IMAGE_SOURCE_H_
+#define OLED_FILE_IMAGE_SOURCE_H_
+
+#include <stdio.h>
+#include "oled_image_source.h"
+
+namespace oled
+{
+  class FileImageSource : public ImageSource
+  {
+  public:
+    // Read the file from the given offset, e.g. to skip a header
+    explicit FileImageSource(const char *path, long offset = 0)
+        : _file(fopen(path, "rb"))
+    {
+      if (_file != NULL && fseek(_file, offset, SEEK_SET) != 0)
+      {
+        fclose(_file);
+        _file = NULL;
+      }
+    }
+
+    ~FileImageSource()
+    {
+      if (_file != NULL)
+      {
+        fclose(_file);
+      }
+    }
+
+    bool is_open() const
+    {
+      return _file != NULL;
+    }
+
+    uint32_t read(uint8_t *buffer, uint32_t size) override
+    {
+      if (_file == NULL)
+      {
+        return 0;
+      }
+      return (uint32_t)fread(buffer, 1, size, _file);
+    }
+
+  private:
+    FILE *_file;
+  };
+} // namespace oled
+
+#endif // OLED_FILE_IMAGE_SOURCE_H_
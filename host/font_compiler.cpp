@@ -0,0 +1,253 @@
+/** OLED Font Compiler
+ *  This file contains the host tool that converts the Hexiwear fonts into
+ *  the span-encoded format described in font/span_font.h.
+ *
+ *  Every glyph is decoded back after encoding and compared pixel by pixel
+ *  against the packed bitmap; the tool fails if they differ.
+ *
+ *  The host build makes it as font_compiler; run it from the repository
+ *  root:
+ *    _build/host/font_compiler > font/opensans_span_font.c
+ *
+ *  The output is only compiled with OLED_SPAN_FONTS set to 1.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "opensans_font.h"
+
+struct FontEntry
+{
+  const char *name;
+  const uint8_t *font;
+};
+
+static const FontEntry fonts[] = {
+    {"OpenSans_18_Regular", OpenSans_18_Regular},
+    {"OpenSans_15_Regular", OpenSans_15_Regular},
+};
+
+// max glyph size supported by the encoding
+#define MAX_WIDTH (16)
+#define MAX_HEIGHT (32)
+
+// Decode a glyph from the packed Hexiwear bitmap
+// Print to the output with CRLF line endings, as in the rest of the tree
+static void emit(const char *format, ...)
+{
+  char text[512];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  for (const char *c = text; *c != 0; c++)
+  {
+    if (*c == '\n')
+    {
+      putchar('\r');
+    }
+    putchar(*c);
+  }
+}
+
+static void decode_bitmap(const uint8_t *bitmap, uint8_t width, uint8_t height,
+                          uint8_t pixels[MAX_HEIGHT][MAX_WIDTH])
+{
+  memset(pixels, 0, MAX_HEIGHT * MAX_WIDTH);
+  uint8_t foo = 0, mask;
+  for (uint8_t y = 0; y < height; y++)
+  {
+    mask = 0;
+    for (uint8_t x = 0; x < width; x++)
+    {
+      if (mask == 0)
+      {
+        mask = 1;
+        foo = *bitmap++;
+      }
+      pixels[y][x] = (foo & mask) != 0;
+      mask <<= 1;
+    }
+  }
+}
+
+// Encode a glyph into a span record
+static std::vector<uint8_t> encode_glyph(uint8_t pixels[MAX_HEIGHT][MAX_WIDTH], uint8_t width, uint8_t height)
+{
+  std::vector<std::vector<uint8_t>> rowSpans(height);
+  for (uint8_t y = 0; y < height; y++)
+  {
+    uint8_t x = 0;
+    while (x < width)
+    {
+      if (!pixels[y][x])
+      {
+        x++;
+        continue;
+      }
+      uint8_t start = x;
+      while (x < width && pixels[y][x])
+      {
+        x++;
+      }
+      rowSpans[y].push_back((uint8_t)((start << 4) | (x - start - 1)));
+    }
+  }
+
+  // trim the empty rows at the top and at the bottom
+  uint8_t top = 0, bottom = height;
+  while (top < height && rowSpans[top].empty())
+  {
+    top++;
+  }
+  while (bottom > top && rowSpans[bottom - 1].empty())
+  {
+    bottom--;
+  }
+
+  std::vector<uint8_t> record;
+  uint8_t rows = bottom - top;
+  record.push_back(top);
+  record.push_back(rows);
+  for (uint8_t r = 0; r < rows; r += 2)
+  {
+    uint8_t counts = (uint8_t)rowSpans[top + r].size();
+    if (r + 1 < rows)
+    {
+      counts |= (uint8_t)(rowSpans[top + r + 1].size() << 4);
+    }
+    record.push_back(counts);
+  }
+  for (uint8_t r = top; r < bottom; r++)
+  {
+    record.insert(record.end(), rowSpans[r].begin(), rowSpans[r].end());
+  }
+  return record;
+}
+
+// Decode a span record, the same way the driver does
+static void decode_record(const uint8_t *record, uint8_t pixels[MAX_HEIGHT][MAX_WIDTH])
+{
+  memset(pixels, 0, MAX_HEIGHT * MAX_WIDTH);
+  uint8_t top = record[0];
+  uint8_t rows = record[1];
+  const uint8_t *counts = record + 2;
+  const uint8_t *spans = counts + ((rows + 1) >> 1);
+  for (uint8_t r = 0; r < rows; r++)
+  {
+    uint8_t n = (counts[r >> 1] >> ((r & 1) << 2)) & 0x0F;
+    while (n--)
+    {
+      uint8_t x = *spans >> 4;
+      uint8_t length = (*spans & 0x0F) + 1;
+      spans++;
+      while (length--)
+      {
+        pixels[top + r][x++] = 1;
+      }
+    }
+  }
+}
+
+static bool compile_font(const FontEntry &entry)
+{
+  const uint8_t *font = entry.font;
+  uint16_t firstChar = font[2] | ((uint16_t)font[3] << 8);
+  uint16_t lastChar = font[4] | ((uint16_t)font[5] << 8);
+  uint8_t height = font[6];
+  uint16_t glyphs = lastChar - firstChar + 1;
+
+  std::vector<uint8_t> widths;
+  std::vector<uint16_t> offsets;
+  std::vector<uint8_t> data;
+  size_t packedSize = 0;
+
+  for (uint16_t i = 0; i < glyphs; i++)
+  {
+    const uint8_t *charOffsetTable = font + 8 + (i << 2);
+    uint8_t width = charOffsetTable[0];
+    uint32_t offset = (uint32_t)charOffsetTable[1] |
+                      ((uint32_t)charOffsetTable[2] << 8) |
+                      ((uint32_t)charOffsetTable[3] << 16);
+    if (width > MAX_WIDTH || height > MAX_HEIGHT)
+    {
+      fprintf(stderr, "%s: glyph %u is too big\n", entry.name, firstChar + i);
+      return false;
+    }
+    packedSize += height * ((width + 7) >> 3);
+
+    uint8_t pixels[MAX_HEIGHT][MAX_WIDTH];
+    uint8_t check[MAX_HEIGHT][MAX_WIDTH];
+    decode_bitmap(font + offset, width, height, pixels);
+    std::vector<uint8_t> record = encode_glyph(pixels, width, height);
+    decode_record(record.data(), check);
+    if (memcmp(pixels, check, sizeof(pixels)) != 0)
+    {
+      fprintf(stderr, "%s: glyph %u does not round-trip\n", entry.name, firstChar + i);
+      return false;
+    }
+
+    widths.push_back(width);
+    offsets.push_back((uint16_t)data.size());
+    data.insert(data.end(), record.begin(), record.end());
+  }
+
+  emit("// %u glyphs: %u bytes of spans, %u bytes of packed bitmaps\n",
+       glyphs, (unsigned)data.size(), (unsigned)packedSize);
+  emit("static const uint8_t %s_Widths[] = {", entry.name);
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    emit("%s0x%02X,", (i % 16) ? " " : "\n    ", widths[i]);
+  }
+  emit("\n};\n\n");
+  emit("static const uint16_t %s_Offsets[] = {", entry.name);
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    emit("%s0x%04X,", (i % 12) ? " " : "\n    ", offsets[i]);
+  }
+  emit("\n};\n\n");
+  emit("static const uint8_t %s_Data[] = {", entry.name);
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    emit("%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+  }
+  emit("\n};\n\n");
+  emit("const SpanFont %s_Spans = {\n", entry.name);
+  emit("    %s,\n    0x%02X,\n    0x%02X,\n    0x%02X,\n", entry.name, firstChar, lastChar, height);
+  emit("    %s_Widths,\n    %s_Offsets,\n    %s_Data};\n\n", entry.name, entry.name, entry.name);
+  return true;
+}
+
+int main()
+{
+  emit("/** OpenSans Span Font\n");
+  emit(" *  This file contains the span-encoded version of the OpenSans fonts.\n");
+  emit(" *\n");
+  emit(" *  Generated by host/font_compiler.cpp, do not edit.\n");
+  emit(" */\n\n");
+  emit("#include \"oled_info.h\"\n");
+  emit("#include \"opensans_font.h\"\n");
+  emit("#include \"span_font.h\"\n\n");
+  emit("#if OLED_SPAN_FONTS\n\n");
+
+  for (const FontEntry &entry : fonts)
+  {
+    if (!compile_font(entry))
+    {
+      return 1;
+    }
+  }
+
+  emit("const SpanFont *const SpanFonts[] = {\n");
+  for (const FontEntry &entry : fonts)
+  {
+    emit("    &%s_Spans,\n", entry.name);
+  }
+  emit("};\n\n");
+  emit("const uint8_t SpanFontsCount = sizeof(SpanFonts) / sizeof(SpanFonts[0]);\n\n");
+  emit("#endif // OLED_SPAN_FONTS\n");
+  return 0;
+}
@@ -0,0 +1,67 @@
+/** Font Walk
+ *  This file contains the walk over a Hexiwear font shared by the host
+ *  tests: the header, the glyph offset table and the packed bitmaps.
+ *
+ *  A font starts with 8 bytes of header, the first and last characters
+ *  at 2 and 4 and the height at 6, followed by 4 bytes per glyph: its
+ *  width and the 24-bit offset of its bitmap, rows of (width + 7) / 8
+ *  bytes, LSB first.
+ */
+
+#ifndef FONT_WALK_H_
+#define FONT_WALK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace oled
+{
+  inline uint16_t font_first_char(const uint8_t *font)
+  {
+    return font[2] | ((uint16_t)font[3] << 8);
+  }
+
+  inline uint16_t font_glyph_count(const uint8_t *font)
+  {
+    uint16_t lastChar = font[4] | ((uint16_t)font[5] << 8);
+    return lastChar - font_first_char(font) + 1;
+  }
+
+  inline uint8_t font_height(const uint8_t *font)
+  {
+    return font[6];
+  }
+
+  inline uint8_t font_glyph_width(const uint8_t *font, uint16_t glyph)
+  {
+    return font[8 + (glyph << 2)];
+  }
+
+  // Offset of the bitmap of a glyph from the start of the font
+  inline size_t font_glyph_offset(const uint8_t *font, uint16_t glyph)
+  {
+    const uint8_t *charOffsetTable = font + 8 + (glyph << 2);
+    return (size_t)charOffsetTable[1] |
+           ((size_t)charOffsetTable[2] << 8) |
+           ((size_t)charOffsetTable[3] << 16);
+  }
+
+  // Copy a font: header, offset table and bitmaps
+  inline std::vector<uint8_t> copy_font(const uint8_t *font)
+  {
+    size_t size = 8 + ((size_t)font_glyph_count(font) << 2);
+    for (uint16_t i = 0; i < font_glyph_count(font); i++)
+    {
+      size_t end = font_glyph_offset(font, i) +
+                   font_height(font) * ((font_glyph_width(font, i) + 7) >> 3);
+      if (end > size)
+      {
+        size = end;
+      }
+    }
+    return std::vector<uint8_t>(font, font + size);
+  }
+} // namespace oled
+
+#endif // FONT_WALK_H_
@@ -0,0 +1,133 @@
+/** Glyph Cache Test
+ *  This file contains the host test of the glyph cache.
+ *
+ *  The cache is first checked on its own: the least recently used glyph
+ *  is evicted, a glyph too big to be cached evicts nothing, and each
+ *  color of a character has its own slot. Then text is drawn by two
+ *  drivers, one with a cache of a few slots and one without, so glyphs
+ *  are evicted and drawn again all the time. The fonts are copies, which
+ *  have no span version, so the glyphs go through the cache. The two
+ *  screens must be the same.
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "oled_ssd1351.h"
+#include "oled_glyph_cache.h"
+#include "opensans_font.h"
+#include "font_walk.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+#define CACHE_SLOTS (4)
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("%s: FAILED\n", what);
+    failures++;
+  }
+}
+
+static void check_cache()
+{
+  const uint8_t *font = OpenSans_15_Regular;
+  // an 8x2 glyph with two runs per row, and one taller than the cache takes
+  static const uint8_t bitmap[OLED_GLYPH_CACHE_MAX_HEIGHT + 1] = {0x3C, 0xC3};
+
+  GlyphCache cache;
+  cache.resize(2);
+  const CachedGlyph *a = cache.insert(font, 'a', 0x1234, bitmap, 8, 2);
+  check(a != NULL && a->rowStart[1] == 1 && a->rowStart[2] == 3 &&
+            a->spans[0].x == 2 && a->spans[0].length == 4,
+        "expanded glyph");
+  cache.insert(font, 'b', 0x1234, bitmap, 8, 2);
+  cache.find(font, 'a', 0x1234);
+
+  // 'b' is the least recently used
+  cache.insert(font, 'a', 0x4321, bitmap, 8, 2);
+  check(cache.find(font, 'b', 0x1234) == NULL, "evict the least recently used");
+  check(cache.find(font, 'a', 0x1234) != NULL && cache.find(font, 'a', 0x4321) != NULL, "one slot per color");
+
+  check(cache.insert(font, 'c', 0x1234, bitmap, 8, OLED_GLYPH_CACHE_MAX_HEIGHT + 1) == NULL, "glyph too tall");
+  check(cache.find(font, 'a', 0x1234) != NULL && cache.find(font, 'a', 0x4321) != NULL, "nothing evicted");
+
+  cache.resize(0);
+  check(cache.insert(font, 'a', 0x1234, bitmap, 8, 2) == NULL, "disabled cache");
+}
+
+static void compare(const SSD1351Emulator &screen, const SSD1351Emulator &reference, const char *step)
+{
+  for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+    {
+      if (screen.pixel(x, y) != reference.pixel(x, y))
+      {
+        printf("%s: pixel %u,%u differs\n", step, x, y);
+        failures++;
+        return;
+      }
+    }
+  }
+}
+
+static void check_text(const uint8_t *source)
+{
+  std::vector<uint8_t> font = copy_font(source);
+
+  SSD1351Emulator screen, reference;
+  SSD1351 oled(&screen);
+  SSD1351 ref(&reference);
+  oled.set_glyph_cache_size(CACHE_SLOTS);
+  ref.set_glyph_cache_size(0);
+
+  TextProperties prop;
+  oled.get_text_properties(&prop);
+  prop.font = font.data();
+
+  // the same characters in turns of colors, more of them than the slots
+  const char *lines[] = {"Heart 72", "Steps 9041", "72 bpm", "aaaa", "Heart 72"};
+  const Color colors[] = {Color::WHITE, Color::RED, (Color)0x1234, Color::WHITE};
+  for (const Color color : colors)
+  {
+    prop.fontColor = color;
+    oled.set_text_properties(&prop);
+    ref.set_text_properties(&prop);
+    oled.fill_screen(Color::BLACK);
+    ref.fill_screen(Color::BLACK);
+    for (uint8_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++)
+    {
+      oled.label(lines[i], 2, i * 18);
+      ref.label(lines[i], 2, i * 18);
+    }
+    compare(screen, reference, "labels");
+  }
+
+  // one character, a color each
+  oled.fill_screen(Color::BLACK);
+  ref.fill_screen(Color::BLACK);
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    prop.fontColor = (Color)(0x0841 * (i + 1));
+    oled.set_text_properties(&prop);
+    ref.set_text_properties(&prop);
+    oled.label("8", i * 11, 40);
+    ref.label("8", i * 11, 40);
+  }
+  compare(screen, reference, "colors");
+}
+
+int main()
+{
+  check_cache();
+  check_text(OpenSans_15_Regular);
+  check_text(OpenSans_18_Regular);
+
+  printf("%u failures\n", failures);
+  return failures != 0;
+}
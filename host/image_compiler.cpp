@@ -0,0 +1,482 @@
+/** OLED Image Compiler
+ *  This file contains the host tool that turns pictures into compressed
+ *  images, in the format described in oled_image.h.
+ *
+ *  The picture is read from a binary PPM (P6) file and converted to
+ *  RGB565. With --encoding auto the tool encodes it in every encoding
+ *  its colors allow and keeps the smallest one, palette included.
+ *
+ *  The image is decoded back with the driver decoder after encoding and
+ *  compared against the RGB565 pixels; the tool fails if they differ.
+ *  With --test it encodes generated pictures in every encoding instead,
+ *  and fails if one of them does not decode back.
+ *
+ *  The host build makes it as image_compiler; run it from the repository
+ *  root:
+ *    _build/host/image_compiler [--encoding auto|rle|palette] --name NAME picture.ppm > picture.cpp
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "oled_image.h"
+
+using namespace oled;
+
+// Pixels of a picture, in the byte order of the screen buffer
+struct Picture
+{
+  int width;
+  int height;
+  std::vector<pixel_t> pixels;
+};
+
+// A picture encoded with one of the encodings
+struct Encoded
+{
+  ImageEncoding encoding;
+  std::vector<pixel_t> palette;
+  std::vector<uint8_t> data;
+
+  size_t size() const
+  {
+    return data.size() + palette.size() * sizeof(pixel_t);
+  }
+};
+
+static int read_number(FILE *f)
+{
+  int c = fgetc(f);
+  while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#')
+  {
+    if (c == '#')
+    {
+      while (c != '\n' && c != EOF)
+      {
+        c = fgetc(f);
+      }
+    }
+    c = fgetc(f);
+  }
+
+  int value = 0;
+  while (c >= '0' && c <= '9')
+  {
+    value = value * 10 + (c - '0');
+    c = fgetc(f);
+  }
+  return value;
+}
+
+static bool read_ppm(const char *path, Picture *picture)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+
+  char magic[2];
+  if (fread(magic, 1, 2, f) != 2 || magic[0] != 'P' || magic[1] != '6')
+  {
+    fprintf(stderr, "%s is not a binary PPM\n", path);
+    fclose(f);
+    return false;
+  }
+
+  picture->width = read_number(f);
+  picture->height = read_number(f);
+  int maxValue = read_number(f);
+  if (picture->width < 1 || picture->width > 255 ||
+      picture->height < 1 || picture->height > 255 ||
+      maxValue != 255)
+  {
+    fprintf(stderr, "%s: unsupported size or depth\n", path);
+    fclose(f);
+    return false;
+  }
+
+  std::vector<uint8_t> rgb(picture->width * picture->height * 3);
+  if (fread(rgb.data(), 1, rgb.size(), f) != rgb.size())
+  {
+    fprintf(stderr, "%s is truncated\n", path);
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+
+  picture->pixels.resize(picture->width * picture->height);
+  for (size_t i = 0; i < picture->pixels.size(); i++)
+  {
+    uint16_t color = ((rgb[i * 3] >> 3) << 11) | ((rgb[i * 3 + 1] >> 2) << 5) | (rgb[i * 3 + 2] >> 3);
+    // the OLED takes the high byte first
+    picture->pixels[i] = (color >> 8) | ((color & 0xFF) << 8);
+  }
+  return true;
+}
+
+// Encode the values as packets; minRun is the shortest run worth a packet
+static void encode_packets(const std::vector<uint16_t> &values, int valueBits, size_t minRun,
+                           std::vector<uint8_t> *data)
+{
+  size_t i = 0;
+  while (i < values.size())
+  {
+    size_t run = 1;
+    while (i + run < values.size() && run < OLED_IMAGE_PACKET_MAX && values[i + run] == values[i])
+    {
+      run++;
+    }
+
+    if (run >= minRun)
+    {
+      data->push_back(OLED_IMAGE_RUN_FLAG | (run - 1));
+      if (valueBits == 16)
+      {
+        data->push_back(values[i] & 0xFF);
+        data->push_back(values[i] >> 8);
+      }
+      else
+      {
+        data->push_back((uint8_t)values[i]);
+      }
+      i += run;
+      continue;
+    }
+
+    // literals last until a run worth a packet starts
+    size_t count = 0;
+    while (i + count < values.size() && count < OLED_IMAGE_PACKET_MAX)
+    {
+      size_t ahead = 1;
+      while (i + count + ahead < values.size() && ahead < minRun &&
+             values[i + count + ahead] == values[i + count])
+      {
+        ahead++;
+      }
+      if (ahead >= minRun)
+      {
+        break;
+      }
+      count++;
+    }
+
+    data->push_back(count - 1);
+    for (size_t k = 0; k < count; k++)
+    {
+      uint16_t value = values[i + k];
+      if (valueBits == 16)
+      {
+        data->push_back(value & 0xFF);
+        data->push_back(value >> 8);
+      }
+      else if (valueBits == 8)
+      {
+        data->push_back((uint8_t)value);
+      }
+      else if (k % 2 == 0)
+      {
+        data->push_back((uint8_t)value);
+      }
+      else
+      {
+        data->back() |= value << 4;
+      }
+    }
+    i += count;
+  }
+}
+
+static Encoded encode_rle(const Picture &picture)
+{
+  Encoded encoded;
+  encoded.encoding = ImageEncoding::RLE;
+  std::vector<uint16_t> values(picture.pixels.begin(), picture.pixels.end());
+  // a run of two pixels takes 3 bytes instead of 4
+  encode_packets(values, 16, 2, &encoded.data);
+  return encoded;
+}
+
+static bool encode_palette(const Picture &picture, Encoded *encoded)
+{
+  std::vector<uint16_t> indexes;
+  for (pixel_t pixel : picture.pixels)
+  {
+    size_t index = 0;
+    while (index < encoded->palette.size() && encoded->palette[index] != pixel)
+    {
+      index++;
+    }
+    if (index == encoded->palette.size())
+    {
+      if (index == 256)
+      {
+        return false;
+      }
+      encoded->palette.push_back(pixel);
+    }
+    indexes.push_back(index);
+  }
+
+  if (encoded->palette.size() <= 16)
+  {
+    // a run takes 2 bytes, as many as four packed literals
+    encoded->encoding = ImageEncoding::PALETTE_16;
+    encode_packets(indexes, 4, 5, &encoded->data);
+  }
+  else
+  {
+    encoded->encoding = ImageEncoding::PALETTE_256;
+    encode_packets(indexes, 8, 3, &encoded->data);
+  }
+  return true;
+}
+
+static bool verify(const Picture &picture, const Encoded &encoded)
+{
+  CompressedImage image = {
+      .width = (uint8_t)picture.width,
+      .height = (uint8_t)picture.height,
+      .encoding = encoded.encoding,
+      .palette = encoded.palette.empty() ? NULL : encoded.palette.data(),
+      .data = encoded.data.data()};
+
+  // decode in odd chunks to exercise the packets split across reads
+  std::vector<pixel_t> decoded(picture.pixels.size() + 1, 0);
+  ImageDecoder decoder;
+  decoder.start(&image);
+  size_t done = 0;
+  while (done < picture.pixels.size())
+  {
+    uint32_t read = decoder.read(decoded.data() + done, 37);
+    if (read == 0)
+    {
+      return false;
+    }
+    done += read;
+  }
+  return decoder.read(decoded.data() + done, 1) == 0 &&
+         memcmp(decoded.data(), picture.pixels.data(), picture.pixels.size() * sizeof(pixel_t)) == 0;
+}
+
+static const char *encoding_name(ImageEncoding encoding)
+{
+  switch (encoding)
+  {
+  case ImageEncoding::RLE:
+    return "RLE";
+  case ImageEncoding::PALETTE_16:
+    return "PALETTE_16";
+  default:
+    return "PALETTE_256";
+  }
+}
+
+// A generated picture with the palette encoding it must get, if any
+struct TestPicture
+{
+  const char *name;
+  int width;
+  int height;
+  uint32_t (*color)(int x, int y);
+  bool palette;
+  ImageEncoding encoding;
+};
+
+static uint32_t gradient_color(int x, int y)
+{
+  return (x * 3) << 16 | (y * 3) << 8 | ((x + y) & 0xFF);
+}
+
+static uint32_t stripes_color(int x, int y)
+{
+  // 12 colors in runs of any length, a few lone pixels between them
+  return (x * y) % 7 == 3 ? 0xFF00FF : ((y / 3) % 11) * 0x171717;
+}
+
+static uint32_t blocks_color(int x, int y)
+{
+  return ((x / 4) * 13 + (y / 5) * 10) % 200 * 0x010305;
+}
+
+static uint32_t solid_color(int, int)
+{
+  return 0x3060F0;
+}
+
+static void make_picture(const TestPicture &test, Picture *picture)
+{
+  picture->width = test.width;
+  picture->height = test.height;
+  picture->pixels.clear();
+  for (int y = 0; y < test.height; y++)
+  {
+    for (int x = 0; x < test.width; x++)
+    {
+      uint32_t rgb = test.color(x, y);
+      uint16_t color = (((rgb >> 16) & 0xFF) >> 3) << 11 | (((rgb >> 8) & 0xFF) >> 2) << 5 | ((rgb & 0xFF) >> 3);
+      picture->pixels.push_back((color >> 8) | ((color & 0xFF) << 8));
+    }
+  }
+}
+
+static int self_test()
+{
+  const TestPicture tests[] = {
+      {"gradient", 96, 96, gradient_color, false, ImageEncoding::RLE},
+      {"stripes", 40, 30, stripes_color, true, ImageEncoding::PALETTE_16},
+      {"blocks", 50, 50, blocks_color, true, ImageEncoding::PALETTE_256},
+      {"solid", 96, 96, solid_color, true, ImageEncoding::PALETTE_16},
+      {"pixel", 1, 1, solid_color, true, ImageEncoding::PALETTE_16},
+  };
+
+  int failures = 0;
+  for (const TestPicture &test : tests)
+  {
+    Picture picture;
+    make_picture(test, &picture);
+
+    Encoded rle = encode_rle(picture);
+    if (!verify(picture, rle))
+    {
+      fprintf(stderr, "%s: RLE does not decode back\n", test.name);
+      failures++;
+    }
+
+    Encoded palette;
+    bool fits = encode_palette(picture, &palette);
+    if (fits != test.palette || (fits && palette.encoding != test.encoding))
+    {
+      fprintf(stderr, "%s: wrong palette encoding\n", test.name);
+      failures++;
+    }
+    else if (fits && !verify(picture, palette))
+    {
+      fprintf(stderr, "%s: %s does not decode back\n", test.name, encoding_name(palette.encoding));
+      failures++;
+    }
+  }
+
+  fprintf(stderr, "%zu pictures checked, %d failed\n", sizeof(tests) / sizeof(tests[0]), failures);
+  return failures != 0;
+}
+
+static void write_image(const char *name, const char *path, const Picture &picture, const Encoded &encoded)
+{
+  printf("/** %s, generated by host/image_compiler.cpp from %s */\n\n", name, path);
+  printf("#include \"oled_image.h\"\n\n");
+
+  if (!encoded.palette.empty())
+  {
+    printf("static const oled::pixel_t %s_palette[%zu] = {", name, encoded.palette.size());
+    for (size_t i = 0; i < encoded.palette.size(); i++)
+    {
+      printf("%s0x%04X,", i % 8 == 0 ? "\n    " : " ", encoded.palette[i]);
+    }
+    printf("\n};\n\n");
+  }
+
+  printf("static const uint8_t %s_data[%zu] = {", name, encoded.data.size());
+  for (size_t i = 0; i < encoded.data.size(); i++)
+  {
+    printf("%s0x%02X,", i % 12 == 0 ? "\n    " : " ", encoded.data[i]);
+  }
+  printf("\n};\n\n");
+
+  printf("extern const oled::CompressedImage %s;\n", name);
+  printf("const oled::CompressedImage %s = {\n", name);
+  printf("    %d, %d, oled::ImageEncoding::%s,\n", picture.width, picture.height, encoding_name(encoded.encoding));
+  if (encoded.palette.empty())
+  {
+    printf("    NULL, %s_data};\n", name);
+  }
+  else
+  {
+    printf("    %s_palette, %s_data};\n", name, name);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *mode = "auto";
+  const char *name = NULL;
+  const char *path = NULL;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--encoding") == 0 && i + 1 < argc)
+    {
+      mode = argv[++i];
+    }
+    else if (strcmp(argv[i], "--name") == 0 && i + 1 < argc)
+    {
+      name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--test") == 0)
+    {
+      return self_test();
+    }
+    else
+    {
+      path = argv[i];
+    }
+  }
+
+  if (name == NULL || path == NULL ||
+      (strcmp(mode, "auto") != 0 && strcmp(mode, "rle") != 0 && strcmp(mode, "palette") != 0))
+  {
+    fprintf(stderr, "usage: %s [--encoding auto|rle|palette] --name NAME picture.ppm\n"
+                    "       %s --test\n",
+            argv[0], argv[0]);
+    return 1;
+  }
+
+  Picture picture;
+  if (!read_ppm(path, &picture))
+  {
+    return 1;
+  }
+
+  std::vector<Encoded> candidates;
+  if (strcmp(mode, "palette") != 0)
+  {
+    candidates.push_back(encode_rle(picture));
+  }
+  if (strcmp(mode, "rle") != 0)
+  {
+    Encoded encoded;
+    if (encode_palette(picture, &encoded))
+    {
+      candidates.push_back(encoded);
+    }
+    else if (strcmp(mode, "palette") == 0)
+    {
+      fprintf(stderr, "%s has more than 256 colors\n", path);
+      return 1;
+    }
+  }
+
+  const Encoded *best = &candidates[0];
+  for (const Encoded &encoded : candidates)
+  {
+    if (encoded.size() < best->size())
+    {
+      best = &encoded;
+    }
+  }
+
+  if (!verify(picture, *best))
+  {
+    fprintf(stderr, "%s: the decoded image differs from the picture\n", path);
+    return 1;
+  }
+
+  fprintf(stderr, "%s: %dx%d, %zu bytes raw, %zu bytes %s\n",
+          path, picture.width, picture.height, picture.pixels.size() * sizeof(pixel_t),
+          best->size(), encoding_name(best->encoding));
+  write_image(name, path, picture, *best);
+  return 0;
+}
@@ -0,0 +1,196 @@
+/** Image Test
+ *  This file contains the host test of the compressed images.
+ *
+ *  Small images written by hand in each encoding, with runs and literals
+ *  across rows and odd numbers of packed indexes, are decoded in chunks
+ *  of every size and compared against their pixels. They are then drawn
+ *  by a driver while a reference driver draws the raw pixels, and a full
+ *  screen compressed image is drawn the same way; the screens must be the
+ *  same.
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "oled_ssd1351.h"
+#include "oled_image.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+#define PIXEL_A (0x1234)
+#define PIXEL_B (0xABCD)
+#define PIXEL_C (0x00FF)
+#define PIXEL_D (0xFF00)
+#define PIXEL_E (0x5A5A)
+
+// 5x3 pixels: a run of 4, 3 literals, a run of 8
+static const uint8_t rleData[] = {
+    0x83, 0x34, 0x12,
+    0x02, 0xCD, 0xAB, 0xFF, 0x00, 0x00, 0xFF,
+    0x87, 0x5A, 0x5A};
+static const pixel_t rlePixels[] = {
+    PIXEL_A, PIXEL_A, PIXEL_A, PIXEL_A, PIXEL_B,
+    PIXEL_C, PIXEL_D, PIXEL_E, PIXEL_E, PIXEL_E,
+    PIXEL_E, PIXEL_E, PIXEL_E, PIXEL_E, PIXEL_E};
+
+// 5x3 indexes: 3 literals, a run of 5, 4 literals, a run of 3
+static const uint8_t palette16Data[] = {
+    0x02, 0x21, 0x03,
+    0x84, 0x0F,
+    0x03, 0x54, 0x76,
+    0x82, 0x00};
+static const uint8_t palette16Indexes[] = {
+    1, 2, 3, 15, 15,
+    15, 15, 15, 4, 5,
+    6, 7, 0, 0, 0};
+
+// 5x3 indexes: a run of 6, 5 literals, a run of 4
+static const uint8_t palette256Data[] = {
+    0x85, 199,
+    0x04, 10, 20, 30, 40, 50,
+    0x83, 0};
+static const uint8_t palette256Indexes[] = {
+    199, 199, 199, 199, 199,
+    199, 10, 20, 30, 40,
+    50, 0, 0, 0, 0};
+
+static uint32_t failures = 0;
+
+static bool check_decoder(const CompressedImage *image, const pixel_t *pixels, const char *name)
+{
+  uint32_t size = image->width * image->height;
+  ImageDecoder decoder;
+  for (uint32_t chunk = 1; chunk <= size + 1; chunk++)
+  {
+    std::vector<pixel_t> decoded(size + chunk, 0);
+    decoder.start(image);
+    uint32_t done = 0;
+    while (done < size)
+    {
+      uint32_t read = decoder.read(decoded.data() + done, chunk);
+      if (read == 0)
+      {
+        break;
+      }
+      done += read;
+    }
+    if (done != size || decoder.read(decoded.data() + done, chunk) != 0)
+    {
+      printf("%s, chunks of %u: %u pixels decoded\n", name, chunk, done);
+      return false;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+      if (decoded[i] != pixels[i])
+      {
+        printf("%s, chunks of %u: pixel %u is 0x%04X\n", name, chunk, i, decoded[i]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void compare(const SSD1351Emulator &screen, const SSD1351Emulator &reference, const char *name)
+{
+  for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+    {
+      if (screen.pixel(x, y) != reference.pixel(x, y))
+      {
+        printf("%s: pixel %u,%u differs\n", name, x, y);
+        failures++;
+        return;
+      }
+    }
+  }
+}
+
+static void check_image(const CompressedImage *image, const pixel_t *pixels, const char *name)
+{
+  if (!check_decoder(image, pixels, name))
+  {
+    failures++;
+    return;
+  }
+
+  SSD1351Emulator screen, reference;
+  SSD1351 oled(&screen);
+  SSD1351 ref(&reference);
+  DynamicArea area = {7, 9, image->width, image->height};
+  oled.set_dynamic_area(area);
+  ref.set_dynamic_area(area);
+  Status status = oled.draw_image(image);
+  ref.draw_image((const uint8_t *)pixels);
+  if (status != Status::SUCCESS)
+  {
+    printf("%s: draw_image failed\n", name);
+    failures++;
+  }
+  compare(screen, reference, name);
+}
+
+int main()
+{
+  pixel_t palette[200];
+  for (int i = 0; i < 200; i++)
+  {
+    palette[i] = (pixel_t)(i * 0x1001 + 3);
+  }
+
+  CompressedImage rle = {5, 3, ImageEncoding::RLE, NULL, rleData};
+  check_image(&rle, rlePixels, "RLE");
+
+  pixel_t pixels[15];
+  CompressedImage palette16 = {5, 3, ImageEncoding::PALETTE_16, palette, palette16Data};
+  for (int i = 0; i < 15; i++)
+  {
+    pixels[i] = palette[palette16Indexes[i]];
+  }
+  check_image(&palette16, pixels, "PALETTE_16");
+
+  CompressedImage palette256 = {5, 3, ImageEncoding::PALETTE_256, palette, palette256Data};
+  for (int i = 0; i < 15; i++)
+  {
+    pixels[i] = palette[palette256Indexes[i]];
+  }
+  check_image(&palette256, pixels, "PALETTE_256");
+
+  // a full screen of runs of 128 pixels, one color each
+  std::vector<uint8_t> screenData;
+  std::vector<pixel_t> screenPixels;
+  for (int run = 0; run < OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT / 128; run++)
+  {
+    screenData.push_back(OLED_IMAGE_RUN_FLAG | 127);
+    screenData.push_back((uint8_t)run);
+    screenPixels.insert(screenPixels.end(), 128, palette[run]);
+  }
+  CompressedImage full = {OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT, ImageEncoding::PALETTE_256,
+                          palette, screenData.data()};
+  if (!check_decoder(&full, screenPixels.data(), "full screen"))
+  {
+    failures++;
+  }
+
+  SSD1351Emulator screen, reference;
+  SSD1351 oled(&screen);
+  SSD1351 ref(&reference);
+  const Transition transitions[] = {Transition::NONE, Transition::TOP_DOWN, Transition::SCROLL_DOWN_TOP};
+  for (Transition transition : transitions)
+  {
+    oled.fill_screen(Color::BLACK);
+    ref.fill_screen(Color::BLACK);
+    Status status = oled.draw_screen(&full, transition);
+    ref.draw_screen((const uint8_t *)screenPixels.data(), Transition::NONE);
+    if (status != Status::SUCCESS)
+    {
+      printf("draw_screen failed\n");
+      failures++;
+    }
+    compare(screen, reference, "draw_screen");
+  }
+
+  printf("%u failures\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,392 @@
+/** OLED Benchmark
+ *  This file contains the host benchmark of the OLED driver.
+ *
+ *  Every public drawing call runs over a representative workload against
+ *  the emulator. For each workload the benchmark reports the CPU time per
+ *  call, the emulator decoding the stream included, the data and command
+ *  bytes sent, the commands, windows and chip selects, and the time the transfer would
+ *  take at the given SPI clock, as JSON.
+ *
+ *  It fails if the pixels of the sensor trace take more than a few
+ *  windows.
+ *
+ *  Usage: oled_ssd1351_bench [--iterations N] [--spi-hz HZ]
+ */
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "oled_ssd1351.h"
+#include "oled_draw_queue.h"
+#include "opensans_font.h"
+#include "font_walk.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+#define SCREEN_PIXELS (OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT)
+
+// most windows the sensor trace may take
+#define TRACE_WINDOWS_MAX (24)
+
+struct Bench
+{
+  SSD1351Emulator transport;
+  SSD1351 oled;
+  uint32_t iterations;
+  uint32_t spiHz;
+  bool first;
+
+  Bench(uint32_t iterations, uint32_t spiHz) : oled(&transport),
+                                                iterations(iterations),
+                                                spiHz(spiHz),
+                                                first(true)
+  {
+  }
+
+  // Run a workload and print its results; setup runs before every call
+  // and is not measured
+  // Returns the windows set up per call
+  template <typename Setup, typename Call>
+  double run(const char *name, Setup setup, Call call)
+  {
+    uint64_t ns = 0;
+    TransportStats total = {0, 0, 0, 0, 0};
+    uint32_t commands = 0;
+    uint32_t windows = 0;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+      setup(i);
+      transport.reset_stats();
+      auto start = std::chrono::steady_clock::now();
+      call(i);
+      auto end = std::chrono::steady_clock::now();
+      ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+      const TransportStats &stats = transport.stats();
+      total.selects += stats.selects;
+      total.dcToggles += stats.dcToggles;
+      total.writeCalls += stats.writeCalls;
+      total.cmdBytes += stats.cmdBytes;
+      total.dataBytes += stats.dataBytes;
+      commands += transport.commands();
+      windows += transport.windows();
+    }
+
+    double bytes = (double)(total.cmdBytes + total.dataBytes) / iterations;
+    printf("%s    {\"name\": \"%s\", \"ns_per_op\": %.0f, \"spi_bytes\": %.0f, "
+           "\"data_bytes\": %.0f, \"cmd_bytes\": %.0f, \"commands\": %.0f, "
+           "\"windows\": %.0f, \"selects\": %.0f, \"write_calls\": %.0f, \"est_wire_us\": %.1f}",
+           first ? "" : ",\n", name,
+           (double)ns / iterations, bytes,
+           (double)total.dataBytes / iterations,
+           (double)total.cmdBytes / iterations,
+           (double)commands / iterations,
+           (double)windows / iterations,
+           (double)total.selects / iterations,
+           (double)total.writeCalls / iterations,
+           bytes * 8 * 1e6 / spiHz);
+    first = false;
+    return (double)windows / iterations;
+  }
+};
+
+static void nothing(uint32_t) {}
+
+// An image source over a memory array, giving out small chunks like a
+// driver of an external flash would
+struct ChunkedSource : public ImageSource
+{
+  const uint8_t *data;
+  uint32_t left;
+
+  void rewind(const void *image, uint32_t size)
+  {
+    data = (const uint8_t *)image;
+    left = size;
+  }
+
+  uint32_t read(uint8_t *buffer, uint32_t size) override
+  {
+    uint32_t count = size < 64 ? size : 64;
+    count = count < left ? count : left;
+    memcpy(buffer, data, count);
+    data += count;
+    left -= count;
+    return count;
+  }
+};
+
+int main(int argc, char **argv)
+{
+  uint32_t iterations = 50;
+  uint32_t spiHz = 8000000;
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    if (strcmp(argv[i], "--iterations") == 0)
+    {
+      iterations = (uint32_t)atoi(argv[i + 1]);
+    }
+    else if (strcmp(argv[i], "--spi-hz") == 0)
+    {
+      spiHz = (uint32_t)atoi(argv[i + 1]);
+    }
+  }
+  if (iterations == 0 || spiHz == 0)
+  {
+    fprintf(stderr, "usage: %s [--iterations N] [--spi-hz HZ]\n", argv[0]);
+    return 1;
+  }
+
+  // synthetic frames: a gradient and two variants of it
+  static pixel_t frame[SCREEN_PIXELS];
+  static pixel_t frameSmall[SCREEN_PIXELS];
+  static pixel_t frameFull[SCREEN_PIXELS];
+  for (uint32_t i = 0; i < SCREEN_PIXELS; i++)
+  {
+    frame[i] = (pixel_t)(i * 37);
+    frameSmall[i] = frame[i];
+    frameFull[i] = (pixel_t)~frame[i];
+  }
+  // a clock digit changing: a 10x16 block
+  for (uint32_t y = 40; y < 56; y++)
+  {
+    for (uint32_t x = 60; x < 70; x++)
+    {
+      frameSmall[y * OLED_SCREEN_WIDTH + x] ^= 0xFFFF;
+    }
+  }
+  // a sensor trace: one sample per column
+  Point trace[OLED_SCREEN_WIDTH];
+  for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+  {
+    trace[x].x = x;
+    trace[x].y = (uint8_t)(48 + 20 * sin(x / 8.0));
+  }
+  static pixel_t icon[32 * 32];
+  for (uint32_t i = 0; i < 32 * 32; i++)
+  {
+    icon[i] = (pixel_t)(i * 5);
+  }
+  // a compressed watch face: horizontal bands of 16 colors, one run per row
+  static pixel_t bandPalette[16];
+  static uint8_t bandData[OLED_SCREEN_HEIGHT * 2];
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    bandPalette[i] = (pixel_t)(i * 0x1111);
+  }
+  for (uint32_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    bandData[y * 2] = OLED_IMAGE_RUN_FLAG | (OLED_SCREEN_WIDTH - 1);
+    bandData[y * 2 + 1] = (uint8_t)(y / 6);
+  }
+  const CompressedImage bands = {
+      .width = OLED_SCREEN_WIDTH,
+      .height = OLED_SCREEN_HEIGHT,
+      .encoding = ImageEncoding::PALETTE_16,
+      .palette = bandPalette,
+      .data = bandData};
+
+  Bench bench(iterations, spiHz);
+  SSD1351 &oled = bench.oled;
+  DynamicArea box = {.xCrd = 20, .yCrd = 20, .width = 32, .height = 32};
+  DynamicArea textArea = {.xCrd = 0, .yCrd = 30, .width = 96, .height = 40};
+
+  printf("{\n  \"iterations\": %u,\n  \"spi_hz\": %u,\n  \"results\": [\n", iterations, spiHz);
+
+  bench.run("fill_screen", nothing, [&](uint32_t i)
+            { oled.fill_screen(i & 1 ? Color::RED : Color::BLUE); });
+
+  const struct
+  {
+    const char *name;
+    Transition transition;
+  } transitions[] = {
+      {"draw_screen/NONE", Transition::NONE},
+      {"draw_screen/TOP_DOWN", Transition::TOP_DOWN},
+      {"draw_screen/DOWN_TOP", Transition::DOWN_TOP},
+      {"draw_screen/LEFT_RIGHT", Transition::LEFT_RIGHT},
+      {"draw_screen/RIGHT_LEFT", Transition::RIGHT_LEFT},
+  };
+  for (const auto &t : transitions)
+  {
+    bench.run(t.name, nothing, [&](uint32_t)
+              { oled.draw_screen((const uint8_t *)frame, t.transition); });
+  }
+
+  // the screen goes around the RAM, so every scroll is done by the OLED
+  bench.run("draw_screen/SCROLL_TOP_DOWN", nothing, [&](uint32_t)
+            { oled.draw_screen((const uint8_t *)frame, Transition::SCROLL_TOP_DOWN); });
+  bench.run("draw_screen/SCROLL_DOWN_TOP", nothing, [&](uint32_t)
+            { oled.draw_screen((const uint8_t *)frame, Transition::SCROLL_DOWN_TOP); });
+  bench.run("draw_screen/compressed", nothing, [&](uint32_t)
+            { oled.draw_screen(&bands, Transition::NONE); });
+  ChunkedSource source;
+  bench.run("draw_screen/source", [&](uint32_t)
+            { source.rewind(frame, sizeof(frame)); },
+            [&](uint32_t)
+            { oled.draw_screen(&source, Transition::NONE); });
+
+  // diff mode over frame sequences: unchanged, one digit, everything
+  oled.set_diff_mode(true);
+  bench.run("draw_screen_diff/static", nothing, [&](uint32_t)
+            { oled.draw_screen((const uint8_t *)frame, Transition::NONE); });
+  bench.run("draw_screen_diff/digit", nothing, [&](uint32_t i)
+            { oled.draw_screen((const uint8_t *)(i & 1 ? frameSmall : frame), Transition::NONE); });
+  bench.run("draw_screen_diff/full", nothing, [&](uint32_t i)
+            { oled.draw_screen((const uint8_t *)(i & 1 ? frameFull : frame), Transition::NONE); });
+  oled.set_diff_mode(false);
+
+  bench.run("draw_image/32x32", [&](uint32_t)
+            { oled.set_dynamic_area(box); },
+            [&](uint32_t)
+            { oled.draw_image((const uint8_t *)icon); });
+  bench.run("draw_box/32x32", [&](uint32_t)
+            { oled.set_dynamic_area(box); },
+            [&](uint32_t i)
+            { oled.draw_box(i & 1 ? Color::GREEN : Color::YELLOW); });
+  bench.run("draw_pixel", nothing, [&](uint32_t i)
+            { oled.draw_pixel(i % OLED_SCREEN_WIDTH, (i * 7) % OLED_SCREEN_HEIGHT, Color::WHITE); });
+  bench.run("draw_pixel/trace96", nothing, [&](uint32_t)
+            {
+              for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+              {
+                oled.draw_pixel(trace[x].x, trace[x].y, Color::CYAN);
+              } });
+  double traceWindows = bench.run("draw_pixels/trace96", nothing, [&](uint32_t)
+                                  { oled.draw_pixels(trace, OLED_SCREEN_WIDTH, Color::CYAN); });
+  bench.run("draw_line/diagonal", nothing, [&](uint32_t)
+            { oled.draw_line(0, 0, OLED_SCREEN_WIDTH - 1, OLED_SCREEN_HEIGHT - 1, Color::WHITE); });
+  bench.run("draw_box_stroke/32x32", [&](uint32_t)
+            { oled.set_dynamic_area(box); },
+            [&](uint32_t)
+            { oled.draw_box_stroke(Color::WHITE, 2); });
+  bench.run("draw_circle/r40", nothing, [&](uint32_t)
+            { oled.draw_circle(48, 48, 40, Color::WHITE); });
+  bench.run("fill_circle/r20", nothing, [&](uint32_t)
+            { oled.fill_circle(48, 48, 20, Color::RED); });
+  bench.run("fill_triangle", nothing, [&](uint32_t)
+            { oled.fill_triangle({10, 10}, {90, 30}, {40, 90}, Color::GREEN); });
+
+  bench.run("label/clock", nothing, [&](uint32_t i)
+            {
+              char text[8];
+              snprintf(text, sizeof(text), "12:%02u", (unsigned)(i % 60));
+              oled.label(text, 20, 40); });
+
+  Label clock;
+  DynamicArea clockArea = {.xCrd = 10, .yCrd = 40, .width = 70, .height = 20};
+  oled.create_label(&clock, clockArea, Color::BLACK);
+  bench.run("update_label/clock", nothing, [&](uint32_t i)
+            {
+              char text[12];
+              snprintf(text, sizeof(text), "12:%02u:%02u", (unsigned)((i / 60) % 60), (unsigned)(i % 60));
+              oled.update_label(&clock, text); });
+
+  TextProperties prop;
+  oled.get_text_properties(&prop);
+  prop.font = OpenSans_18_Regular;
+  prop.alignParam = TEXT_ALIGN_CENTER | TEXT_ALIGN_VCENTER;
+  oled.set_text_properties(&prop);
+  bench.run("text_box/two_lines", [&](uint32_t)
+            { oled.set_dynamic_area(textArea); },
+            [&](uint32_t)
+            { oled.text_box("Heart rate\n72 bpm"); });
+  TextLayout layout;
+  oled.layout_text("Heart rate\n72 bpm", &layout);
+  bench.run("text_box/cached_layout", [&](uint32_t)
+            { oled.set_dynamic_area(textArea); },
+            [&](uint32_t)
+            { oled.text_box(&layout); });
+  oled.set_text_antialiasing(true);
+  bench.run("text_box/antialiased", [&](uint32_t)
+            { oled.set_dynamic_area(textArea); },
+            [&](uint32_t)
+            { oled.text_box("Heart rate\n72 bpm"); });
+  oled.set_text_antialiasing(false);
+
+  // a copy of the font has no span version, so its glyphs are walked in
+  // the packed bitmap or taken from the glyph cache
+  std::vector<uint8_t> bitmapFont = copy_font(OpenSans_18_Regular);
+  prop.font = bitmapFont.data();
+  oled.set_text_properties(&prop);
+  bench.run("text_box/bitmap", [&](uint32_t)
+            { oled.set_dynamic_area(textArea); },
+            [&](uint32_t)
+            { oled.text_box("Heart rate\n72 bpm"); });
+  oled.set_glyph_cache_size(16);
+  bench.run("text_box/glyph_cache", [&](uint32_t)
+            { oled.set_dynamic_area(textArea); },
+            [&](uint32_t)
+            { oled.text_box("Heart rate\n72 bpm"); });
+  oled.set_glyph_cache_size(0);
+  prop.font = OpenSans_18_Regular;
+  oled.set_text_properties(&prop);
+
+  // scene: a keyed 16x16 sprite moving over the background and a clock
+  static pixel_t sprite[16 * 16];
+  for (uint32_t i = 0; i < 16 * 16; i++)
+  {
+    sprite[i] = (i % 16 + i / 16) & 4 ? (pixel_t)(i * 97) : 0;
+  }
+  Layer ball = {0, 40, 16, 16, (const uint8_t *)sprite, true, Color::BLACK, NULL, NULL, Color::WHITE, true};
+  Layer clockLayer = {20, 4, 56, 20, NULL, false, Color::BLACK, "12:34", OpenSans_15_Regular, Color::WHITE, true};
+  oled.set_scene_background((const uint8_t *)frame);
+  oled.add_layer(&clockLayer);
+  oled.add_layer(&ball);
+  oled.compose();
+  bench.run("compose/sprite_move", nothing, [&](uint32_t i)
+            {
+              oled.move_layer(&ball, (int16_t)(i % 80), (int16_t)(40 + (i & 7)));
+              oled.compose(); });
+  oled.remove_layer(&ball);
+  oled.remove_layer(&clockLayer);
+
+  // draw queue: a progress bar updated four times between two
+  // consumer runs; only the last update is drawn
+  DrawQueue queue(&oled);
+  bench.run("queue/box_merged", nothing, [&](uint32_t i)
+            {
+              for (uint8_t k = 0; k < 4; k++)
+              {
+                DynamicArea bar = {.xCrd = 8, .yCrd = 80, .width = 80, .height = 6};
+                queue.box(bar, (Color)(i * 4 + k));
+              }
+              queue.process(); });
+
+  // retained mode: one digit changes, then flush
+  oled.set_retained_mode(true);
+  bench.run("retained/label_flush", nothing, [&](uint32_t i)
+            {
+              char text[4];
+              snprintf(text, sizeof(text), "%u", (unsigned)(i % 10));
+              oled.label(text, 40, 40);
+              oled.flush(); });
+  oled.set_retained_mode(false);
+
+#if OLED_RENDERER
+  // renderer: the same digit, sent by the display thread; the empty
+  // present() waits for the frame so that its traffic is counted
+  oled.start_renderer();
+  bench.run("renderer/label_present", nothing, [&](uint32_t i)
+            {
+              char text[4];
+              snprintf(text, sizeof(text), "%u", (unsigned)(i % 10));
+              oled.label(text, 40, 40);
+              oled.present();
+              oled.present(); });
+  oled.stop_renderer();
+#endif
+
+  printf("\n  ]\n}\n");
+
+  if (traceWindows > TRACE_WINDOWS_MAX)
+  {
+    fprintf(stderr, "draw_pixels/trace96: %.0f windows, expected at most %d\n", traceWindows, TRACE_WINDOWS_MAX);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,180 @@
+/** Scroll Test
+ *  This file contains the host test of the scroll transitions.
+ *
+ *  A driver scrolls in the same direction over and over, so the screen
+ *  goes all around the OLED RAM, while a reference driver draws the same
+ *  images without transition. After each scroll both draw the same boxes,
+ *  labels, images and other transitions, and the two screens must be the
+ *  same. Every scroll must be done by the OLED, sending a single frame.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_ssd1351.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+#define SCREEN_PIXELS (OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT)
+
+// An image source over a memory array, giving out odd-sized chunks
+struct MemorySource : public ImageSource
+{
+  const uint8_t *data;
+  uint32_t left;
+
+  MemorySource(const void *image, uint32_t size) : data((const uint8_t *)image), left(size)
+  {
+  }
+
+  uint32_t read(uint8_t *buffer, uint32_t size) override
+  {
+    uint32_t count = size < 100 ? size : 100;
+    count = count < left ? count : left;
+    memcpy(buffer, data, count);
+    data += count;
+    left -= count;
+    return count;
+  }
+};
+
+static pixel_t frames[4][SCREEN_PIXELS];
+static pixel_t sprite[40 * 30];
+
+static uint32_t failures = 0;
+
+static void compare(const SSD1351Emulator &screen, const SSD1351Emulator &reference, const char *step, int pass)
+{
+  for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+    {
+      if (screen.pixel(x, y) != reference.pixel(x, y))
+      {
+        printf("pass %d, %s: pixel %u,%u differs\n", pass, step, x, y);
+        failures++;
+        return;
+      }
+    }
+  }
+}
+
+int main()
+{
+  for (int f = 0; f < 4; f++)
+  {
+    for (int i = 0; i < SCREEN_PIXELS; i++)
+    {
+      frames[f][i] = (pixel_t)((i * 2654435761u) >> (8 + f * 3));
+    }
+  }
+  for (int i = 0; i < 40 * 30; i++)
+  {
+    sprite[i] = (pixel_t)(i * 40503u);
+  }
+
+  SSD1351Emulator screen, reference;
+  SSD1351 oled(&screen);
+  SSD1351 ref(&reference);
+  DynamicArea full = {0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT};
+
+  // down four times, up four times, then back and forth
+  const Transition scrolls[] = {
+      Transition::SCROLL_TOP_DOWN, Transition::SCROLL_TOP_DOWN,
+      Transition::SCROLL_TOP_DOWN, Transition::SCROLL_TOP_DOWN,
+      Transition::SCROLL_DOWN_TOP, Transition::SCROLL_DOWN_TOP,
+      Transition::SCROLL_DOWN_TOP, Transition::SCROLL_DOWN_TOP,
+      Transition::SCROLL_DOWN_TOP, Transition::SCROLL_TOP_DOWN,
+      Transition::SCROLL_TOP_DOWN, Transition::SCROLL_DOWN_TOP};
+  int passes = sizeof(scrolls) / sizeof(scrolls[0]);
+
+  for (int pass = 0; pass < passes; pass++)
+  {
+    const uint8_t *frame = (const uint8_t *)frames[pass & 3];
+
+    screen.reset_stats();
+    oled.draw_screen(frame, scrolls[pass]);
+    ref.draw_screen(frame, Transition::NONE);
+    compare(screen, reference, "scroll", pass);
+    if (screen.stats().dataBytes > SCREEN_PIXELS * sizeof(pixel_t) + 1024)
+    {
+      printf("pass %d: the scroll sent %u bytes\n", pass, screen.stats().dataBytes);
+      failures++;
+    }
+
+    // a window across the end of the RAM whatever the screen position
+    DynamicArea box = {8, 30, 60, 50};
+    oled.set_dynamic_area(box);
+    ref.set_dynamic_area(box);
+    oled.draw_box(Color::RED);
+    ref.draw_box(Color::RED);
+    compare(screen, reference, "draw_box", pass);
+
+    oled.label("Wrap", 4, 70);
+    ref.label("Wrap", 4, 70);
+    compare(screen, reference, "label", pass);
+
+    DynamicArea image = {50, 20, 40, 30};
+    oled.set_dynamic_area(image);
+    ref.set_dynamic_area(image);
+    oled.draw_image((const uint8_t *)sprite);
+    ref.draw_image((const uint8_t *)sprite);
+    compare(screen, reference, "draw_image", pass);
+
+    oled.draw_image_async((const uint8_t *)sprite, NULL, NULL);
+    ref.draw_image_async((const uint8_t *)sprite, NULL, NULL);
+    while (oled.is_busy() || ref.is_busy())
+    {
+    }
+    compare(screen, reference, "draw_image_async", pass);
+
+    DynamicArea rows = {0, 10, OLED_SCREEN_WIDTH, 70};
+    oled.set_dynamic_area(rows);
+    ref.set_dynamic_area(rows);
+    MemorySource source(frames[(pass + 1) & 3], OLED_SCREEN_WIDTH * 70 * sizeof(pixel_t));
+    MemorySource refSource(frames[(pass + 1) & 3], OLED_SCREEN_WIDTH * 70 * sizeof(pixel_t));
+    oled.draw_image(&source);
+    ref.draw_image(&refSource);
+    compare(screen, reference, "draw_image/source", pass);
+
+    oled.set_retained_mode(true);
+    ref.set_retained_mode(true);
+    oled.fill_circle(48, 48, 20, Color::GREEN);
+    ref.fill_circle(48, 48, 20, Color::GREEN);
+    oled.flush();
+    ref.flush();
+    oled.set_retained_mode(false);
+    ref.set_retained_mode(false);
+    compare(screen, reference, "flush", pass);
+
+    oled.start_renderer();
+    ref.start_renderer();
+    oled.set_dynamic_area(box);
+    ref.set_dynamic_area(box);
+    oled.draw_box(Color::BLUE);
+    ref.draw_box(Color::BLUE);
+    oled.present();
+    ref.present();
+    oled.stop_renderer();
+    ref.stop_renderer();
+    compare(screen, reference, "present", pass);
+
+    // the column transitions only show their last frame in the reference
+    oled.set_dynamic_area(full);
+    ref.set_dynamic_area(full);
+    oled.draw_screen((const uint8_t *)frames[(pass + 2) & 3],
+                     pass & 1 ? Transition::LEFT_RIGHT : Transition::RIGHT_LEFT);
+    ref.draw_screen((const uint8_t *)frames[(pass + 2) & 3], Transition::NONE);
+    compare(screen, reference, "column transition", pass);
+
+    oled.draw_screen_async(frame, NULL, NULL);
+    ref.draw_screen_async(frame, NULL, NULL);
+    while (oled.is_busy() || ref.is_busy())
+    {
+    }
+    compare(screen, reference, "draw_screen_async", pass);
+  }
+
+  printf("%d scrolls checked, %u failures\n", passes, failures);
+  return failures != 0;
+}
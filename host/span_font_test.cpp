@@ -0,0 +1,88 @@
+/** Span Font Test
+ *  This file contains the host test of the span-encoded fonts.
+ *
+ *  Every glyph of the fonts with a span version is drawn by two drivers:
+ *  one is given the font itself and draws its span version, the other a
+ *  copy of the font, which has no span version and is drawn from the
+ *  packed bitmap. The two screens must be the same.
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "oled_ssd1351.h"
+#include "span_font.h"
+#include "font_walk.h"
+#include "ssd1351_emulator.h"
+
+using namespace oled;
+
+static bool check_font(const SpanFont *spanFont)
+{
+  std::vector<uint8_t> bitmapFont = copy_font(spanFont->source);
+
+  SSD1351Emulator spanScreen, bitmapScreen;
+  SSD1351 spanOled(&spanScreen);
+  SSD1351 bitmapOled(&bitmapScreen);
+  // the glyph cache would be used instead of the bitmap walk
+  bitmapOled.set_glyph_cache_size(0);
+
+  TextProperties prop;
+  spanOled.get_text_properties(&prop);
+  prop.font = spanFont->source;
+  prop.fontColor = Color::WHITE;
+  spanOled.set_text_properties(&prop);
+  prop.font = bitmapFont.data();
+  bitmapOled.set_text_properties(&prop);
+
+  uint32_t lit = 0;
+  for (uint16_t c = spanFont->firstChar; c <= spanFont->lastChar; c++)
+  {
+    char text[2] = {(char)c, 0};
+    spanOled.fill_screen(Color::BLACK);
+    bitmapOled.fill_screen(Color::BLACK);
+    Status spanStatus = spanOled.label(text, 3, 5);
+    Status bitmapStatus = bitmapOled.label(text, 3, 5);
+    if (spanStatus != Status::SUCCESS || bitmapStatus != Status::SUCCESS)
+    {
+      printf("glyph 0x%02X: label failed\n", c);
+      return false;
+    }
+
+    for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+    {
+      for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+      {
+        pixel_t pixel = spanScreen.pixel(x, y);
+        if (pixel != bitmapScreen.pixel(x, y))
+        {
+          printf("glyph 0x%02X: pixel %u,%u differs\n", c, x, y);
+          return false;
+        }
+        lit += pixel != Color::BLACK;
+      }
+    }
+  }
+
+  // make sure the glyphs were drawn at all
+  if (lit == 0)
+  {
+    printf("no pixel drawn\n");
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  int failures = 0;
+  for (uint8_t i = 0; i < SpanFontsCount; i++)
+  {
+    if (!check_font(SpanFonts[i]))
+    {
+      printf("span font %u: FAILED\n", i);
+      failures++;
+    }
+  }
+  printf("%u span fonts checked, %d failed\n", SpanFontsCount, failures);
+  return failures != 0;
+}
@@ -0,0 +1,294 @@
+/** SSD1351 Emulator
+ *  This file contains a host-side model of the SSD1351 controller.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1351_emulator.h"
+
+namespace oled
+{
+  SSD1351Emulator::SSD1351Emulator() : _data(false),
+                                       _cmd(OLED_CMD_NOP),
+                                       _arg_count(0),
+                                       _high_byte(true),
+                                       _pixel_high(0),
+                                       _col_start(0),
+                                       _col_end(EMU_RAM_COLUMNS - 1),
+                                       _row_start(0),
+                                       _row_end(EMU_RAM_ROWS - 1),
+                                       _col(0),
+                                       _row(0),
+                                       _vertical_increment(false),
+                                       _start_line(0),
+                                       _display_offset(EMU_INIT_DISPLAY_OFFSET),
+                                       _master_contrast(0x0F),
+                                       _display_mode(OLED_CMD_SET_DISPLAY_MODE_NORMAL),
+                                       _sleep(true),
+                                       _powered(false),
+                                       _windows(0)
+  {
+    memset(_ram, 0, sizeof(_ram));
+    memset(_args, 0, sizeof(_args));
+    memset(_contrast_abc, 0xFF, sizeof(_contrast_abc));
+  }
+
+  void SSD1351Emulator::set_power(bool on)
+  {
+    _powered = on;
+  }
+
+  void SSD1351Emulator::set_reset(bool active)
+  {
+    if (active)
+    {
+      _sleep = true;
+      _start_line = 0;
+      _display_offset = EMU_INIT_DISPLAY_OFFSET;
+      _vertical_increment = false;
+    }
+  }
+
+  void SSD1351Emulator::set_data_mode(bool data)
+  {
+    CountingTransport::set_data_mode(data);
+    _data = data;
+  }
+
+  void SSD1351Emulator::write(const uint8_t *data, uint32_t size)
+  {
+    CountingTransport::write(data, size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+      decode(data[i]);
+    }
+  }
+
+  pixel_t SSD1351Emulator::pixel(uint8_t x, uint8_t y) const
+  {
+    uint8_t row = (uint8_t)((y + OLED_ROW_OFFSET + _start_line +
+                             _display_offset - EMU_INIT_DISPLAY_OFFSET) %
+                            EMU_RAM_ROWS);
+    return _ram[row][x + OLED_COLUMN_OFFSET];
+  }
+
+  pixel_t SSD1351Emulator::ram(uint8_t column, uint8_t row) const
+  {
+    return _ram[row][column];
+  }
+
+  uint32_t SSD1351Emulator::commands() const
+  {
+    // command arguments travel as data, so command bytes are opcodes
+    return stats().cmdBytes;
+  }
+
+  uint32_t SSD1351Emulator::windows() const
+  {
+    return _windows;
+  }
+
+  void SSD1351Emulator::reset_stats()
+  {
+    CountingTransport::reset_stats();
+    _windows = 0;
+  }
+
+  uint8_t SSD1351Emulator::master_contrast() const
+  {
+    return _master_contrast;
+  }
+
+  uint8_t SSD1351Emulator::channel_contrast(uint8_t channel) const
+  {
+    return _contrast_abc[channel];
+  }
+
+  uint8_t SSD1351Emulator::start_line() const
+  {
+    return _start_line;
+  }
+
+  uint8_t SSD1351Emulator::display_offset() const
+  {
+    return _display_offset;
+  }
+
+  bool SSD1351Emulator::dump_ppm(const char *path) const
+  {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+      return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT);
+    for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+    {
+      for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+      {
+        pixel_t color = pixel(x, y);
+        if (_display_mode == OLED_CMD_SET_DISPLAY_MODE_ALL_OFF || _sleep || !_powered)
+        {
+          color = 0x0000;
+        }
+        else if (_display_mode == OLED_CMD_SET_DISPLAY_MODE_ALL_ON)
+        {
+          color = 0xFFFF;
+        }
+        else if (_display_mode == OLED_CMD_SET_DISPLAY_MODE_INVERSE)
+        {
+          color = ~color;
+        }
+
+        // expand RGB565 to RGB888 and apply the master contrast
+        uint16_t scale = _master_contrast + 1;
+        uint8_t rgb[3] = {
+            (uint8_t)((((color >> 11) & 0x1F) * 255 / 31) * scale / 16),
+            (uint8_t)((((color >> 5) & 0x3F) * 255 / 63) * scale / 16),
+            (uint8_t)(((color & 0x1F) * 255 / 31) * scale / 16)};
+        fwrite(rgb, 1, sizeof(rgb), file);
+      }
+    }
+
+    fclose(file);
+    return true;
+  }
+
+  void SSD1351Emulator::decode(uint8_t byte)
+  {
+    if (!_data)
+    {
+      _cmd = byte;
+      _arg_count = 0;
+      switch (_cmd)
+      {
+      case OLED_CMD_WRITERAM:
+        _col = _col_start;
+        _row = _row_start;
+        _high_byte = true;
+        break;
+      case OLED_CMD_SET_COLUMN:
+        _windows++;
+        break;
+      case OLED_CMD_SET_DISPLAY_MODE_ALL_OFF:
+      case OLED_CMD_SET_DISPLAY_MODE_ALL_ON:
+      case OLED_CMD_SET_DISPLAY_MODE_NORMAL:
+      case OLED_CMD_SET_DISPLAY_MODE_INVERSE:
+        _display_mode = _cmd;
+        break;
+      case OLED_CMD_SET_SLEEP_MODE_ON:
+        _sleep = true;
+        break;
+      case OLED_CMD_SET_SLEEP_MODE_OFF:
+        _sleep = false;
+        break;
+      default:
+        break;
+      }
+      return;
+    }
+
+    if (_cmd == OLED_CMD_WRITERAM)
+    {
+      // pixels are sent MSB first
+      if (_high_byte)
+      {
+        _pixel_high = byte;
+      }
+      else
+      {
+        write_pixel((pixel_t)((_pixel_high << 8) | byte));
+      }
+      _high_byte = !_high_byte;
+      return;
+    }
+
+    if (_arg_count < sizeof(_args))
+    {
+      _args[_arg_count] = byte;
+    }
+    _arg_count++;
+
+    switch (_cmd)
+    {
+    case OLED_CMD_SET_COLUMN:
+      if (_arg_count == 2)
+      {
+        _col_start = _args[0] % EMU_RAM_COLUMNS;
+        _col_end = _args[1] % EMU_RAM_COLUMNS;
+        _col = _col_start;
+      }
+      break;
+    case OLED_CMD_SET_ROW:
+      if (_arg_count == 2)
+      {
+        _row_start = _args[0] % EMU_RAM_ROWS;
+        _row_end = _args[1] % EMU_RAM_ROWS;
+        _row = _row_start;
+      }
+      break;
+    case OLED_CMD_SET_REMAP:
+      if (_arg_count == 1)
+      {
+        _vertical_increment = (_args[0] & REMAP_VERTICAL_INCREMENT) != 0;
+      }
+      break;
+    case OLED_CMD_STARTLINE:
+      if (_arg_count == 1)
+      {
+        _start_line = _args[0] % EMU_RAM_ROWS;
+      }
+      break;
+    case OLED_CMD_DISPLAYOFFSET:
+      if (_arg_count == 1)
+      {
+        _display_offset = _args[0] % EMU_RAM_ROWS;
+      }
+      break;
+    case OLED_CMD_CONTRASTMASTER:
+      if (_arg_count == 1)
+      {
+        _master_contrast = _args[0] & 0x0F;
+      }
+      break;
+    case OLED_CMD_CONTRASTABC:
+      if (_arg_count <= 3)
+      {
+        _contrast_abc[_arg_count - 1] = byte;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  void SSD1351Emulator::write_pixel(pixel_t color)
+  {
+    _ram[_row][_col] = color;
+
+    // advance the address pointer inside the window, wrapping around
+    if (_vertical_increment)
+    {
+      if (++_row > _row_end)
+      {
+        _row = _row_start;
+        if (++_col > _col_end)
+        {
+          _col = _col_start;
+        }
+      }
+    }
+    else
+    {
+      if (++_col > _col_end)
+      {
+        _col = _col_start;
+        if (++_row > _row_end)
+        {
+          _row = _row_start;
+        }
+      }
+    }
+  }
+} // namespace oled
@@ -0,0 +1,100 @@
+/** SSD1351 Emulator
+ *  This file contains a host-side model of the SSD1351 controller.
+ *
+ *  The emulator is a transport: give it to the driver and it decodes the
+ *  command stream into an emulated GDDRAM while counting the traffic.
+ *  The displayed image can be read back pixel by pixel or dumped to PPM.
+ *
+ *  Modelled commands: column/row window, remap (address increment),
+ *  write RAM, start line, display offset, contrast, display modes and
+ *  sleep. The start line and display offset set by the init sequence
+ *  display RAM rows 0-95; changes to them scroll the view.
+ */
+
+#ifndef SSD1351_EMULATOR_H_
+#define SSD1351_EMULATOR_H_
+
+#include <stdint.h>
+#include "counting_transport.h"
+#include "oled_info.h"
+#include "oled_types.h"
+
+// size of the controller RAM
+#define EMU_RAM_COLUMNS (128)
+#define EMU_RAM_ROWS (128)
+
+// display offset set by the init sequence
+#define EMU_INIT_DISPLAY_OFFSET (0x60)
+
+namespace oled
+{
+  class SSD1351Emulator : public CountingTransport
+  {
+  public:
+    SSD1351Emulator();
+
+    void set_power(bool on) override;
+    void set_reset(bool active) override;
+    void set_data_mode(bool data) override;
+    void write(const uint8_t *data, uint32_t size) override;
+
+    // Get the RGB565 color of a pixel as seen on the screen
+    pixel_t pixel(uint8_t x, uint8_t y) const;
+
+    // Get the RGB565 color of a RAM cell
+    pixel_t ram(uint8_t column, uint8_t row) const;
+
+    // Get the number of commands received
+    uint32_t commands() const;
+
+    // Get the number of windows set up: column ranges received
+    uint32_t windows() const;
+
+    // Reset the traffic counters, the windows included
+    void reset_stats();
+
+    // Get the master contrast, 0-15
+    uint8_t master_contrast() const;
+
+    // Get the contrast of the given color channel (0: A, 1: B, 2: C)
+    uint8_t channel_contrast(uint8_t channel) const;
+
+    // Get the current start line and display offset
+    uint8_t start_line() const;
+    uint8_t display_offset() const;
+
+    // Write the screen as seen by the user into a binary PPM file
+    // Colors are scaled by the master contrast
+    bool dump_ppm(const char *path) const;
+
+  private:
+    pixel_t _ram[EMU_RAM_ROWS][EMU_RAM_COLUMNS];
+
+    // Decoder state
+    bool _data;
+    uint8_t _cmd;
+    uint8_t _args[4];
+    uint8_t _arg_count;
+    bool _high_byte;
+    uint8_t _pixel_high;
+
+    // Controller registers
+    uint8_t _col_start, _col_end, _row_start, _row_end;
+    uint8_t _col, _row;
+    bool _vertical_increment;
+    uint8_t _start_line;
+    uint8_t _display_offset;
+    uint8_t _master_contrast;
+    uint8_t _contrast_abc[3];
+    uint8_t _display_mode;
+    bool _sleep;
+    bool _powered;
+
+    uint32_t _windows;
+
+    void decode(uint8_t byte);
+    void write_pixel(pixel_t color);
+  };
+} // namespace oled
+
+#endif // SSD1351_EMULATOR_H_
@@ -0,0 +1,110 @@
+/** OLED Threaded Transport
+ *  This file contains a host-side transport stub that completes
+ *  asynchronous transfers on a worker thread, like a DMA engine would.
+ *
+ *  The bytes go to the base transport at once, a CountingTransport or an
+ *  SSD1351Emulator; the completions are queued to a single worker thread,
+ *  so a callback may start the next transfer.
+ */
+
+#ifndef OLED_THREADED_TRANSPORT_H_
+#define OLED_THREADED_TRANSPORT_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "counting_transport.h"
+
+namespace oled
+{
+  template <class Base = CountingTransport>
+  class ThreadedTransport : public Base
+  {
+  public:
+    // Every asynchronous transfer lasts for the given time before completing
+    explicit ThreadedTransport(std::chrono::microseconds transferTime = std::chrono::microseconds(0))
+        : _transfer_time(transferTime),
+          _completing(false),
+          _stop(false)
+    {
+      _worker = std::thread(&ThreadedTransport::run, this);
+    }
+
+    ~ThreadedTransport()
+    {
+      join();
+      {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stop = true;
+      }
+      _wake.notify_all();
+      _worker.join();
+    }
+
+    // The completions run in the order the transfers were started
+    void write_async(const uint8_t *data, uint32_t size,
+                     TransferCallback callback, void *context) override
+    {
+      std::lock_guard<std::mutex> lock(_lock);
+      this->write(data, size);
+      _queue.push_back(Transfer{callback, context});
+      _wake.notify_all();
+    }
+
+    // Wait for every transfer started so far, and the ones their
+    // callbacks start, to complete
+    // Must not be called from a callback
+    void join()
+    {
+      std::unique_lock<std::mutex> lock(_lock);
+      _idle.wait(lock, [this]()
+                 { return _queue.empty() && !_completing; });
+    }
+
+  private:
+    struct Transfer
+    {
+      TransferCallback callback;
+      void *context;
+    };
+
+    std::chrono::microseconds _transfer_time;
+    std::mutex _lock;
+    std::condition_variable _wake;
+    std::condition_variable _idle;
+    std::deque<Transfer> _queue;
+    bool _completing;
+    bool _stop;
+    std::thread _worker;
+
+    void run()
+    {
+      std::unique_lock<std::mutex> lock(_lock);
+      while (true)
+      {
+        _wake.wait(lock, [this]()
+                   { return _stop || !_queue.empty(); });
+        if (_queue.empty())
+        {
+          return;
+        }
+        Transfer transfer = _queue.front();
+        _queue.pop_front();
+        _completing = true;
+
+        // the callback may start another transfer
+        lock.unlock();
+        std::this_thread::sleep_for(_transfer_time);
+        transfer.callback(transfer.context);
+        lock.lock();
+
+        _completing = false;
+        _idle.notify_all();
+      }
+    }
+  };
+} // namespace oled
+
+#endif // OLED_THREADED_TRANSPORT_H_
@@ -0,0 +1,128 @@
+/** Threaded Transport Test
+ *  This file contains the host test of the asynchronous transfers.
+ *
+ *  Full screens are pushed through a ThreadedTransport over the emulator,
+ *  so they complete on its worker thread. Each callback checks the frame
+ *  it was called for is on the screen and the driver is no longer busy,
+ *  then chains the next frame. A drawing call made while a transfer runs
+ *  must wait for it.
+ */
+
+#include <stdio.h>
+#include <atomic>
+#include "oled_ssd1351.h"
+#include "ssd1351_emulator.h"
+#include "threaded_transport.h"
+
+using namespace oled;
+
+#define FRAMES (4)
+#define TRANSFER_US (2000)
+
+typedef ThreadedTransport<SSD1351Emulator> ThreadedEmulator;
+
+static pixel_t frames[FRAMES][OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT];
+
+struct Chain
+{
+  SSD1351 *oled;
+  ThreadedEmulator *screen;
+  int sent;
+  bool busy;      // the driver was busy in a callback
+  bool wrong;     // a callback saw the wrong pixels
+  bool refused;   // a chained transfer was not started
+  std::atomic<bool> done;
+};
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("%s: FAILED\n", what);
+    failures++;
+  }
+}
+
+static bool screen_is(const SSD1351Emulator &screen, const pixel_t *image)
+{
+  for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+  {
+    for (uint8_t x = 0; x < OLED_SCREEN_WIDTH; x++)
+    {
+      pixel_t pixel = image[y * OLED_SCREEN_WIDTH + x];
+      if (screen.pixel(x, y) != (pixel_t)((pixel >> 8) | (pixel << 8)))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void frame_sent(void *context)
+{
+  Chain *chain = (Chain *)context;
+  chain->busy |= chain->oled->is_busy();
+  chain->wrong |= !screen_is(*chain->screen, frames[chain->sent]);
+
+  if (++chain->sent == FRAMES)
+  {
+    chain->done = true;
+    return;
+  }
+  Status status = chain->oled->draw_screen_async((const uint8_t *)frames[chain->sent], frame_sent, chain);
+  if (status != Status::SUCCESS)
+  {
+    chain->refused = true;
+    chain->done = true;
+  }
+}
+
+int main()
+{
+  for (int f = 0; f < FRAMES; f++)
+  {
+    for (int i = 0; i < OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT; i++)
+    {
+      frames[f][i] = (pixel_t)((i * 2654435761u) >> (8 + f * 3));
+    }
+  }
+
+  ThreadedEmulator screen(std::chrono::microseconds(TRANSFER_US));
+  SSD1351 oled(&screen);
+
+  // every frame after the first is started from the callback of the one before
+  Chain chain;
+  chain.oled = &oled;
+  chain.screen = &screen;
+  chain.sent = 0;
+  chain.busy = false;
+  chain.wrong = false;
+  chain.refused = false;
+  chain.done = false;
+  check(oled.draw_screen_async((const uint8_t *)frames[0], frame_sent, &chain) == Status::SUCCESS, "first frame");
+  check(oled.is_busy(), "busy while sending");
+  check(oled.draw_screen_async((const uint8_t *)frames[1], NULL, NULL) == Status::BUSY, "second transfer");
+  while (!chain.done)
+  {
+    std::this_thread::yield();
+  }
+  screen.join();
+  check(chain.sent == FRAMES && !chain.refused, "chained frames");
+  check(!chain.busy, "idle in callback");
+  check(!chain.wrong, "pixels in callback");
+  check(!oled.is_busy(), "idle at the end");
+  check(screen_is(screen, frames[FRAMES - 1]), "last frame");
+
+  // a drawing call waits for the transfer before it touches the screen
+  oled.draw_screen_async((const uint8_t *)frames[0], NULL, NULL);
+  oled.fill_screen(Color::RED);
+  screen.join();
+  check(!oled.is_busy(), "idle after fill");
+  check(screen.pixel(0, 0) == (pixel_t)Color::RED && screen.pixel(95, 95) == (pixel_t)Color::RED, "fill after transfer");
+
+  printf("%d frames chained, %u failures\n", chain.sent, failures);
+  return failures != 0;
+}
@@ -0,0 +1,341 @@
+/** OLED Animator
+ *  This file contains the scheduler that runs animations at a steady
+ *  frame rate.
+ */
+
+#include <string.h>
+#include "oled_animator.h"
+#include "oled_image_source.h"
+#if defined(__MBED__)
+#include "mbed.h"
+#else
+#include <chrono>
+#endif
+
+namespace oled
+{
+  // Image source over a rectangle of a full-screen image
+  struct ImageRectSource : public ImageSource
+  {
+    const uint8_t *image;
+    DynamicArea rect;
+    uint32_t offset; // bytes of the rectangle already read
+
+    ImageRectSource(const uint8_t *fullImage, DynamicArea area) : image(fullImage), rect(area), offset(0)
+    {
+    }
+
+    uint32_t read(uint8_t *buffer, uint32_t size) override
+    {
+      uint32_t rowBytes = rect.width * sizeof(pixel_t);
+      uint32_t total = rowBytes * rect.height;
+      uint32_t done = 0;
+      while (done < size && offset < total)
+      {
+        uint32_t row = offset / rowBytes;
+        uint32_t column = offset % rowBytes;
+        uint32_t count = rowBytes - column < size - done ? rowBytes - column : size - done;
+        memcpy(buffer + done,
+               image + ((rect.yCrd + row) * OLED_SCREEN_WIDTH + rect.xCrd) * sizeof(pixel_t) + column,
+               count);
+        done += count;
+        offset += count;
+      }
+      return done;
+    }
+  };
+
+  Animator::Animator(SSD1351 *oled, uint8_t fps, AnimatorClock clock)
+      : _oled(oled),
+        _clock(clock != NULL ? clock : &Animator::platform_clock),
+        _frame_us(1000000 / (fps > 0 ? fps : 1)),
+        _next_frame_us(0),
+        _started(false),
+        _count(0)
+  {
+    _stats.frames = 0;
+    _stats.skipped = 0;
+    _stats.lastFrameUs = 0;
+    _stats.maxFrameUs = 0;
+  }
+
+  Status Animator::start(Animation *animation)
+  {
+    // starting a running animation starts it over
+    stop(animation);
+    if (_count == OLED_ANIMATIONS_MAX)
+    {
+      return Status::QUEUE_FULL;
+    }
+
+    // the clock starts at the first frame
+    animation->running = false;
+    _animations[_count++] = animation;
+
+    return Status::SUCCESS;
+  }
+
+  Status Animator::dim_screen(Animation *animation, ContrastFade *fade, bool dim, uint32_t durationMs)
+  {
+    _oled->get_contrast(&fade->target);
+    fade->target.master = dim ? 0 : 0xF;
+    fade->easing = Easing::LINEAR;
+
+    // an animation of 0 ms would run until stopped, at its first frame
+    if (durationMs == 0)
+    {
+      stop(animation);
+      _oled->set_contrast(fade->target);
+      return Status::SUCCESS;
+    }
+
+    animation->step = step_contrast_fade;
+    animation->context = fade;
+    animation->durationMs = durationMs;
+    return start(animation);
+  }
+
+  void Animator::stop(Animation *animation)
+  {
+    for (uint8_t i = 0; i < _count; i++)
+    {
+      if (_animations[i] == animation)
+      {
+        for (uint8_t j = i + 1; j < _count; j++)
+        {
+          _animations[j - 1] = _animations[j];
+        }
+        _count--;
+        break;
+      }
+    }
+    animation->running = false;
+  }
+
+  bool Animator::is_running(const Animation *animation)
+  {
+    for (uint8_t i = 0; i < _count; i++)
+    {
+      if (_animations[i] == animation)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  uint32_t Animator::tick()
+  {
+    uint32_t now = _clock();
+    if (!_started)
+    {
+      _next_frame_us = now;
+      _started = true;
+    }
+
+    int32_t late = (int32_t)(now - _next_frame_us);
+    if (late < 0)
+    {
+      return (uint32_t)-late;
+    }
+
+    // frames missed because the last one ran over its budget, or
+    // because tick() came late, are merged into this one
+    uint32_t missed = (uint32_t)late / _frame_us;
+    _stats.skipped += missed;
+    _next_frame_us += (missed + 1) * _frame_us;
+
+    if (_count > 0)
+    {
+      uint8_t i = 0;
+      while (i < _count)
+      {
+        Animation *animation = _animations[i];
+        if (!animation->running)
+        {
+          animation->startUs = now;
+          animation->running = true;
+        }
+
+        uint32_t elapsedMs = (now - animation->startUs) / 1000;
+        bool done = animation->durationMs != 0 && elapsedMs >= animation->durationMs;
+        uint16_t progress = 0;
+        if (done)
+        {
+          progress = OLED_ANIMATION_PROGRESS_MAX;
+        }
+        else if (animation->durationMs != 0)
+        {
+          progress = (uint16_t)((uint64_t)elapsedMs * OLED_ANIMATION_PROGRESS_MAX / animation->durationMs);
+        }
+
+        animation->step(_oled, animation->context, elapsedMs, progress);
+        if (done)
+        {
+          stop(animation);
+        }
+        else
+        {
+          i++;
+        }
+      }
+
+      // compose the layers the steps moved, then send what the steps
+      // left in the screen buffer in retained mode
+      _oled->compose();
+#if OLED_RENDERER
+      _oled->present();
+#else
+      _oled->flush();
+#endif
+
+      uint32_t frameUs = _clock() - now;
+      _stats.frames++;
+      _stats.lastFrameUs = frameUs;
+      if (frameUs > _stats.maxFrameUs)
+      {
+        _stats.maxFrameUs = frameUs;
+      }
+    }
+
+    int32_t wait = (int32_t)(_next_frame_us - _clock());
+    return wait > 0 ? (uint32_t)wait : 0;
+  }
+
+  const AnimatorStats &Animator::stats()
+  {
+    return _stats;
+  }
+
+  void Animator::step_wipe(SSD1351 *oled, void *context, uint32_t, uint16_t progress)
+  {
+    WipeAnimation *wipe = (WipeAnimation *)context;
+    if (progress == 0)
+    {
+      wipe->rows = 0;
+    }
+
+    // draw only the rows uncovered since the last frame
+    uint8_t rows = (uint8_t)((uint32_t)progress * OLED_SCREEN_HEIGHT / OLED_ANIMATION_PROGRESS_MAX);
+    if (rows <= wipe->rows)
+    {
+      return;
+    }
+
+    DynamicArea strip = {
+        .xCrd = 0,
+        .yCrd = wipe->rows,
+        .width = OLED_SCREEN_WIDTH,
+        .height = (uint8_t)(rows - wipe->rows)};
+    oled->set_dynamic_area(strip);
+    oled->draw_image(wipe->image + (uint32_t)wipe->rows * OLED_SCREEN_WIDTH * sizeof(pixel_t));
+    wipe->rows = rows;
+  }
+
+  void Animator::step_slide(SSD1351 *oled, void *context, uint32_t, uint16_t progress)
+  {
+    SlideAnimation *slide = (SlideAnimation *)context;
+    if (progress == 0)
+    {
+      slide->shown = 0;
+    }
+
+    bool vertical = slide->transition == Transition::TOP_DOWN || slide->transition == Transition::DOWN_TOP;
+    uint8_t size = vertical ? OLED_SCREEN_HEIGHT : OLED_SCREEN_WIDTH;
+    uint8_t shown = (uint8_t)((uint32_t)progress * size / OLED_ANIMATION_PROGRESS_MAX);
+    if (shown <= slide->shown)
+    {
+      return;
+    }
+    slide->shown = shown;
+
+    // the image moves, so the whole part on screen is drawn again: the
+    // far edge of the image enters first
+    DynamicArea part, area;
+    switch (slide->transition)
+    {
+    case Transition::TOP_DOWN:
+      part = {0, (uint8_t)(size - shown), OLED_SCREEN_WIDTH, shown};
+      area = {0, 0, OLED_SCREEN_WIDTH, shown};
+      break;
+    case Transition::DOWN_TOP:
+      part = {0, 0, OLED_SCREEN_WIDTH, shown};
+      area = {0, (uint8_t)(size - shown), OLED_SCREEN_WIDTH, shown};
+      break;
+    case Transition::LEFT_RIGHT:
+      part = {(uint8_t)(size - shown), 0, shown, OLED_SCREEN_HEIGHT};
+      area = {0, 0, shown, OLED_SCREEN_HEIGHT};
+      break;
+    default:
+      part = {0, 0, shown, OLED_SCREEN_HEIGHT};
+      area = {(uint8_t)(size - shown), 0, shown, OLED_SCREEN_HEIGHT};
+      break;
+    }
+
+    ImageRectSource source(slide->image, part);
+    oled->set_dynamic_area(area);
+    oled->draw_image(&source);
+  }
+
+  void Animator::step_move_layer(SSD1351 *oled, void *context, uint32_t, uint16_t progress)
+  {
+    LayerMoveAnimation *move = (LayerMoveAnimation *)context;
+    int16_t x = move->fromX + (int32_t)(move->toX - move->fromX) * progress / OLED_ANIMATION_PROGRESS_MAX;
+    int16_t y = move->fromY + (int32_t)(move->toY - move->fromY) * progress / OLED_ANIMATION_PROGRESS_MAX;
+    if (x != move->layer->x || y != move->layer->y)
+    {
+      oled->move_layer(move->layer, x, y);
+    }
+  }
+
+  void Animator::step_contrast_fade(SSD1351 *oled, void *context, uint32_t, uint16_t progress)
+  {
+    ContrastFade *fade = (ContrastFade *)context;
+    if (progress == 0)
+    {
+      oled->get_contrast(&fade->from);
+    }
+
+    // set_contrast() only sends the values that changed, so most frames
+    // of a slow fade cost a few bytes or nothing
+    int32_t eased = ease(fade->easing, progress);
+    Contrast contrast;
+    contrast.master = fade->from.master + ((fade->target.master - fade->from.master) * eased) / OLED_ANIMATION_PROGRESS_MAX;
+    contrast.a = fade->from.a + ((fade->target.a - fade->from.a) * eased) / OLED_ANIMATION_PROGRESS_MAX;
+    contrast.b = fade->from.b + ((fade->target.b - fade->from.b) * eased) / OLED_ANIMATION_PROGRESS_MAX;
+    contrast.c = fade->from.c + ((fade->target.c - fade->from.c) * eased) / OLED_ANIMATION_PROGRESS_MAX;
+    oled->set_contrast(contrast);
+  }
+
+  uint16_t Animator::ease(Easing easing, uint16_t progress)
+  {
+    const uint32_t max = OLED_ANIMATION_PROGRESS_MAX;
+    uint32_t p = progress;
+    switch (easing)
+    {
+    case Easing::EASE_IN:
+      return p * p / max;
+    case Easing::EASE_OUT:
+      return max - (max - p) * (max - p) / max;
+    case Easing::EASE_IN_OUT:
+      if (p < max / 2)
+      {
+        return 2 * p * p / max;
+      }
+      return max - 2 * (max - p) * (max - p) / max;
+    default:
+      return p;
+    }
+  }
+
+  uint32_t Animator::platform_clock()
+  {
+#if defined(__MBED__)
+    return us_ticker_read();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+} // namespace oled
@@ -0,0 +1,158 @@
+/** OLED Animator
+ *  This file contains the scheduler that runs animations at a steady
+ *  frame rate: the application calls tick() from its main loop, a thread
+ *  or an event queue, and each call draws at most one frame. A call with
+ *  no frame due returns at once; a frame waits for its SPI transfers and,
+ *  with the renderer, for the previous frame to be sent. So tick() must
+ *  not be called from a Ticker or any other interrupt.
+ *
+ *  The animations are driven by the time elapsed since they started, not
+ *  by the number of frames, so a frame that runs over its budget makes the
+ *  next one jump ahead: the missed frames are merged into it.
+ */
+
+#ifndef OLED_ANIMATOR_H_
+#define OLED_ANIMATOR_H_
+
+#include <stdint.h>
+#include "oled_info.h"
+#include "oled_types.h"
+#include "oled_ssd1351.h"
+
+// max number of animations running at once
+#define OLED_ANIMATIONS_MAX (8)
+
+// progress of an animation at its end
+#define OLED_ANIMATION_PROGRESS_MAX (256)
+
+// duration of dim_screen(), as long as the blocking dim loop once took
+#define OLED_DIM_FADE_MS (320)
+
+namespace oled
+{
+  // Time source in microseconds; it may wrap around
+  typedef uint32_t (*AnimatorClock)();
+
+  // Draw one frame of an animation
+  // progress goes from 0 to OLED_ANIMATION_PROGRESS_MAX, which is always
+  // the last call; endless animations get 0
+  typedef void (*AnimationStep)(SSD1351 *oled, void *context, uint32_t elapsedMs, uint16_t progress);
+
+  // Represent an animation; kept by the caller while it runs
+  struct Animation
+  {
+    AnimationStep step;
+    void *context;
+    uint32_t durationMs; // 0 runs until stop()
+
+    // state kept by the animator
+    uint32_t startUs;
+    bool running;
+  };
+
+  // Represent the frame timing measured by the animator
+  struct AnimatorStats
+  {
+    uint32_t frames;      // frames drawn
+    uint32_t skipped;     // frames merged into later ones
+    uint32_t lastFrameUs; // time spent drawing and sending the last frame
+    uint32_t maxFrameUs;  // longest frame
+  };
+
+  // Context of step_wipe(): reveal a full-screen image from the top
+  struct WipeAnimation
+  {
+    const uint8_t *image;
+    uint8_t rows; // rows already drawn
+  };
+
+  // Context of step_slide(): slide a full-screen image in over the screen,
+  // as draw_screen() does with TOP_DOWN, DOWN_TOP, LEFT_RIGHT or RIGHT_LEFT
+  struct SlideAnimation
+  {
+    const uint8_t *image;
+    Transition transition;
+    uint8_t shown; // rows or columns of the image on screen
+  };
+
+  // Context of step_move_layer(): move a layer of the scene along a line
+  struct LayerMoveAnimation
+  {
+    Layer *layer;
+    int16_t fromX;
+    int16_t fromY;
+    int16_t toX;
+    int16_t toY;
+  };
+
+  // Context of step_contrast_fade(): fade the contrast from where it is
+  // when the animation starts to the target
+  struct ContrastFade
+  {
+    Contrast target;
+    Easing easing;
+
+    // state kept by the step
+    Contrast from;
+  };
+
+  class Animator
+  {
+  public:
+    // Run the animations on the given driver at the given frame rate
+    // Without a clock the platform one is used
+    Animator(SSD1351 *oled, uint8_t fps, AnimatorClock clock = NULL);
+
+    // Start an animation; it gets its first frame at the next tick()
+    Status start(Animation *animation);
+
+    // Stop an animation, without a last frame
+    void stop(Animation *animation);
+
+    // Check if an animation is still running
+    bool is_running(const Animation *animation);
+
+    // Draw a frame of every running animation if one is due, compose the
+    // scene and send it
+    // Call it from a thread or an event queue, not from an interrupt: the
+    // frame is sent over SPI, and present() waits for the previous one
+    // Returns the microseconds until the next frame is due
+    uint32_t tick();
+
+    // Get the frame timing
+    const AnimatorStats &stats();
+
+    // Fade the master contrast out, as SSD1351::dim_screen_on() used to,
+    // or back to full with dim set to false
+    // The animation and the fade are kept by the caller while it runs;
+    // with a duration of 0 the contrast changes at once
+    Status dim_screen(Animation *animation, ContrastFade *fade, bool dim,
+                      uint32_t durationMs = OLED_DIM_FADE_MS);
+
+    // Ready-made animation steps; the context is the struct named after them
+    // The scroll transitions have no step: they move the start line of
+    // the OLED, which the driver only does within draw_screen(), so they
+    // run at the pace of the OLED rather than at the frame rate
+    static void step_wipe(SSD1351 *oled, void *context, uint32_t elapsedMs, uint16_t progress);
+    static void step_slide(SSD1351 *oled, void *context, uint32_t elapsedMs, uint16_t progress);
+    static void step_move_layer(SSD1351 *oled, void *context, uint32_t elapsedMs, uint16_t progress);
+    static void step_contrast_fade(SSD1351 *oled, void *context, uint32_t elapsedMs, uint16_t progress);
+
+    // Shape a progress with an easing curve, both 0 to OLED_ANIMATION_PROGRESS_MAX
+    static uint16_t ease(Easing easing, uint16_t progress);
+
+  private:
+    SSD1351 *_oled;
+    AnimatorClock _clock;
+    uint32_t _frame_us;
+    uint32_t _next_frame_us;
+    bool _started;
+    Animation *_animations[OLED_ANIMATIONS_MAX];
+    uint8_t _count;
+    AnimatorStats _stats;
+
+    static uint32_t platform_clock();
+  };
+} // namespace oled
+
+#endif // OLED_ANIMATOR_H_
@@ -0,0 +1,61 @@
+/** OLED Command List
+ *  This file contains the builder that gathers command and argument bytes
+ *  so they reach the OLED in a single chip select.
+ */
+
+#include "oled_command_list.h"
+#if defined(__MBED__)
+#include "mbed_assert.h"
+#define COMMAND_LIST_ASSERT(expr) MBED_ASSERT(expr)
+#else
+#include <assert.h>
+#define COMMAND_LIST_ASSERT(expr) assert(expr)
+#endif
+
+namespace oled
+{
+  CommandList::CommandList() : _count(0)
+  {
+  }
+
+  CommandList &CommandList::add(Command command)
+  {
+    COMMAND_LIST_ASSERT(_count < OLED_COMMAND_LIST_SIZE);
+
+    // without assertions the byte is dropped rather than overflowing
+    if (_count < OLED_COMMAND_LIST_SIZE)
+    {
+      _bytes[_count] = (uint8_t)command.cmd;
+      _types[_count] = command.type;
+      _count++;
+    }
+    return *this;
+  }
+
+  void CommandList::clear()
+  {
+    _count = 0;
+  }
+
+  uint8_t CommandList::size() const
+  {
+    return _count;
+  }
+
+  void CommandList::write(Transport *transport) const
+  {
+    uint8_t start = 0;
+    while (start < _count)
+    {
+      uint8_t end = start + 1;
+      while (end < _count && _types[end] == _types[start])
+      {
+        end++;
+      }
+
+      transport->set_data_mode(_types[start] == DATA_BYTE);
+      transport->write(_bytes + start, end - start);
+      start = end;
+    }
+  }
+} // namespace oled
@@ -0,0 +1,47 @@
+/** OLED Command List
+ *  This file contains the builder that gathers command and argument bytes
+ *  so they reach the OLED in a single chip select.
+ */
+
+#ifndef OLED_COMMAND_LIST_H_
+#define OLED_COMMAND_LIST_H_
+
+#include <stdint.h>
+#include "oled_info.h"
+#include "oled_types.h"
+#include "oled_transport.h"
+
+// max number of bytes in a command list; the init sequence is the longest
+#define OLED_COMMAND_LIST_SIZE (48)
+
+namespace oled
+{
+  class CommandList
+  {
+  public:
+    CommandList();
+
+    // Append a command or argument byte
+    // A list never takes more than OLED_COMMAND_LIST_SIZE bytes: going past
+    // it is a bug of the caller, caught by an assertion
+    CommandList &add(Command command);
+
+    // Forget all the bytes
+    void clear();
+
+    // Get the number of bytes in the list
+    uint8_t size() const;
+
+    // Write every byte, changing the D/C line only between runs of
+    // command bytes and runs of argument bytes
+    // Must be called between select() and deselect()
+    void write(Transport *transport) const;
+
+  private:
+    uint8_t _bytes[OLED_COMMAND_LIST_SIZE];
+    uint8_t _types[OLED_COMMAND_LIST_SIZE];
+    uint8_t _count;
+  };
+} // namespace oled
+
+#endif // OLED_COMMAND_LIST_H_
@@ -0,0 +1,108 @@
+/** OLED Dirty Region
+ *  This file contains the tracker of the screen areas that changed in the
+ *  screen buffer but have not been sent to the OLED yet.
+ */
+
+#include "oled_dirty_region.h"
+
+namespace oled
+{
+  static uint16_t area_size(const DynamicArea &a)
+  {
+    return (uint16_t)a.width * a.height;
+  }
+
+  static DynamicArea area_union(const DynamicArea &a, const DynamicArea &b)
+  {
+    uint8_t x0 = a.xCrd < b.xCrd ? a.xCrd : b.xCrd;
+    uint8_t y0 = a.yCrd < b.yCrd ? a.yCrd : b.yCrd;
+    uint8_t x1 = (a.xCrd + a.width) > (b.xCrd + b.width) ? (a.xCrd + a.width) : (b.xCrd + b.width);
+    uint8_t y1 = (a.yCrd + a.height) > (b.yCrd + b.height) ? (a.yCrd + a.height) : (b.yCrd + b.height);
+
+    DynamicArea u = {
+        .xCrd = x0,
+        .yCrd = y0,
+        .width = (uint8_t)(x1 - x0),
+        .height = (uint8_t)(y1 - y0)};
+    return u;
+  }
+
+  // number of pixels sent in excess if a and b are sent as one window
+  static int32_t merge_cost(const DynamicArea &a, const DynamicArea &b)
+  {
+    return (int32_t)area_size(area_union(a, b)) - area_size(a) - area_size(b);
+  }
+
+  DirtyRegion::DirtyRegion() : _count(0)
+  {
+  }
+
+  void DirtyRegion::add(DynamicArea area)
+  {
+    if (area.width == 0 || area.height == 0)
+    {
+      return;
+    }
+
+    // merge with the existing rectangles as long as it is worth it;
+    // a merged rectangle may now touch other ones so keep going
+    bool merged = true;
+    while (merged)
+    {
+      merged = false;
+      for (uint8_t i = 0; i < _count; i++)
+      {
+        if (merge_cost(_rects[i], area) <= OLED_DIRTY_MERGE_SLACK)
+        {
+          area = area_union(_rects[i], area);
+          remove(i);
+          merged = true;
+          break;
+        }
+      }
+    }
+
+    // no room left: merge with the rectangle that grows the least
+    if (_count == OLED_DIRTY_RECT_MAX)
+    {
+      uint8_t best = 0;
+      int32_t bestCost = merge_cost(_rects[0], area);
+      for (uint8_t i = 1; i < _count; i++)
+      {
+        int32_t cost = merge_cost(_rects[i], area);
+        if (cost < bestCost)
+        {
+          best = i;
+          bestCost = cost;
+        }
+      }
+      area = area_union(_rects[best], area);
+      remove(best);
+      add(area);
+      return;
+    }
+
+    _rects[_count++] = area;
+  }
+
+  void DirtyRegion::clear()
+  {
+    _count = 0;
+  }
+
+  uint8_t DirtyRegion::count() const
+  {
+    return _count;
+  }
+
+  DynamicArea DirtyRegion::get(uint8_t i) const
+  {
+    return _rects[i];
+  }
+
+  void DirtyRegion::remove(uint8_t i)
+  {
+    _rects[i] = _rects[_count - 1];
+    _count--;
+  }
+} // namespace oled
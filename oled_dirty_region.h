@@ -0,0 +1,47 @@
+/** OLED Dirty Region
+ *  This file contains the tracker of the screen areas that changed in the
+ *  screen buffer but have not been sent to the OLED yet.
+ */
+
+#ifndef OLED_DIRTY_REGION_H_
+#define OLED_DIRTY_REGION_H_
+
+#include <stdint.h>
+#include "oled_types.h"
+
+// max number of separate rectangles tracked at once
+#define OLED_DIRTY_RECT_MAX (8)
+
+// number of extra pixels worth sending to save a window setup;
+// a window setup costs 7 command bytes plus their framing
+#define OLED_DIRTY_MERGE_SLACK (32)
+
+namespace oled
+{
+  class DirtyRegion
+  {
+  public:
+    DirtyRegion();
+
+    // Mark the given area as changed
+    void add(DynamicArea area);
+
+    // Forget all the changed areas
+    void clear();
+
+    // Get the number of rectangles to send
+    uint8_t count() const;
+
+    // Get the i-th rectangle to send
+    DynamicArea get(uint8_t i) const;
+
+  private:
+    DynamicArea _rects[OLED_DIRTY_RECT_MAX];
+    uint8_t _count;
+
+    // Remove the i-th rectangle
+    void remove(uint8_t i);
+  };
+} // namespace oled
+
+#endif // OLED_DIRTY_REGION_H_
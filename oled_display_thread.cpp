@@ -0,0 +1,136 @@
+/** OLED Display Thread
+ *  This file contains the thread the renderer uses to send frames to the
+ *  OLED while the application draws the next one.
+ */
+
+#include "oled_display_thread.h"
+
+#if OLED_RENDERER
+
+namespace oled
+{
+#if defined(__MBED__)
+  // thread flag raised by signal()
+  #define DISPLAY_FLAG_WAKE (1)
+
+  DisplayThread::DisplayThread() : _work(NULL),
+                                   _context(NULL),
+                                   _running(false),
+                                   _thread(NULL)
+  {
+  }
+
+  void DisplayThread::start(DisplayWork work, void *context)
+  {
+    _work = work;
+    _context = context;
+    _running = true;
+
+    // above the application, so a frame is sent as soon as it is ready
+#if OLED_STATIC_BUFFERS
+    _thread = new (_thread_storage) rtos::Thread(osPriorityAboveNormal, OLED_RENDERER_STACK_SIZE, _stack);
+#else
+    _thread = new rtos::Thread(osPriorityAboveNormal, OLED_RENDERER_STACK_SIZE);
+#endif
+    _thread->start(callback(this, &DisplayThread::loop));
+  }
+
+  void DisplayThread::signal()
+  {
+    _thread->flags_set(DISPLAY_FLAG_WAKE);
+  }
+
+  void DisplayThread::stop()
+  {
+    if (_thread == NULL)
+    {
+      return;
+    }
+
+    _running = false;
+    signal();
+    _thread->join();
+#if OLED_STATIC_BUFFERS
+    _thread->~Thread();
+#else
+    delete _thread;
+#endif
+    _thread = NULL;
+  }
+
+  void DisplayThread::loop()
+  {
+    while (true)
+    {
+      rtos::ThisThread::flags_wait_any(DISPLAY_FLAG_WAKE);
+      if (!_running)
+      {
+        return;
+      }
+      _work(_context);
+    }
+  }
+#else
+  DisplayThread::DisplayThread() : _work(NULL),
+                                   _context(NULL),
+                                   _running(false),
+                                   _signalled(false)
+  {
+  }
+
+  void DisplayThread::start(DisplayWork work, void *context)
+  {
+    _work = work;
+    _context = context;
+    _running = true;
+    _signalled = false;
+    _thread = std::thread(&DisplayThread::loop, this);
+  }
+
+  void DisplayThread::signal()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _signalled = true;
+    }
+    _wake.notify_one();
+  }
+
+  void DisplayThread::stop()
+  {
+    if (!_thread.joinable())
+    {
+      return;
+    }
+
+    _running = false;
+    signal();
+    _thread.join();
+  }
+
+  void DisplayThread::loop()
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wake.wait(lock, [this]()
+                   { return _signalled; });
+        _signalled = false;
+      }
+      if (!_running)
+      {
+        return;
+      }
+      _work(_context);
+    }
+  }
+#endif
+
+  DisplayThread::~DisplayThread()
+  {
+    stop();
+  }
+} // namespace oled
+
+#endif // OLED_RENDERER
@@ -0,0 +1,71 @@
+/** OLED Display Thread
+ *  This file contains the thread the renderer uses to send frames to the
+ *  OLED while the application draws the next one.
+ *
+ *  On Mbed-OS it is an RTOS thread woken by thread flags; on a host it is
+ *  a std::thread woken by a condition variable.
+ */
+
+#ifndef OLED_DISPLAY_THREAD_H_
+#define OLED_DISPLAY_THREAD_H_
+
+#include "oled_info.h"
+
+#if OLED_RENDERER
+
+#include <atomic>
+#if defined(__MBED__)
+#include <new>
+#include "mbed.h"
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace oled
+{
+  // Function run by the display thread each time it is signalled
+  typedef void (*DisplayWork)(void *context);
+
+  class DisplayThread
+  {
+  public:
+    DisplayThread();
+    ~DisplayThread();
+
+    // Start the thread; work runs once for every signal()
+    void start(DisplayWork work, void *context);
+
+    // Wake the thread up to run the work
+    void signal();
+
+    // Let the running work complete and stop the thread
+    void stop();
+
+  private:
+    DisplayWork _work;
+    void *_context;
+    std::atomic<bool> _running;
+#if defined(__MBED__)
+    rtos::Thread *_thread;
+#if OLED_STATIC_BUFFERS
+    // the thread and its stack are built in place, so starting the
+    // renderer takes nothing from the heap
+    alignas(rtos::Thread) uint8_t _thread_storage[sizeof(rtos::Thread)];
+    alignas(8) unsigned char _stack[OLED_RENDERER_STACK_SIZE];
+#endif
+#else
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _signalled;
+#endif
+
+    void loop();
+  };
+} // namespace oled
+
+#endif // OLED_RENDERER
+
+#endif // OLED_DISPLAY_THREAD_H_
@@ -0,0 +1,287 @@
+/** OLED Draw Queue
+ *  This file contains the queue that lets many threads draw on the same
+ *  OLED: producers enqueue draw operations from any thread without locks,
+ *  and a single consumer runs them on the driver in order.
+ *
+ *  Each slot has a sequence number: a producer claims the slot at the
+ *  tail with a compare-and-swap and publishes it by moving its sequence
+ *  one step ahead; the consumer frees it by moving the sequence a whole
+ *  lap ahead.
+ */
+
+#include "oled_draw_queue.h"
+
+namespace oled
+{
+  // check if the inner area lies completely inside the outer one
+  static bool area_contains(DynamicArea outer, DynamicArea inner)
+  {
+    return inner.xCrd >= outer.xCrd &&
+           inner.yCrd >= outer.yCrd &&
+           inner.xCrd + inner.width <= outer.xCrd + outer.width &&
+           inner.yCrd + inner.height <= outer.yCrd + outer.height;
+  }
+
+  DrawQueue::DrawQueue(SSD1351 *oled) : _oled(oled),
+                                        _tail(0),
+                                        _head(0)
+  {
+    for (uint32_t i = 0; i < OLED_DRAW_QUEUE_SIZE; i++)
+    {
+      _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  Status DrawQueue::fill(Color color)
+  {
+    DrawOp op;
+    op.type = DrawOpType::FILL;
+    op.area.xCrd = 0;
+    op.area.yCrd = 0;
+    op.area.width = OLED_SCREEN_WIDTH;
+    op.area.height = OLED_SCREEN_HEIGHT;
+    op.color = color;
+    op.image = NULL;
+    op.text[0] = '\0';
+
+    return push(op);
+  }
+
+  Status DrawQueue::box(DynamicArea area, Color color)
+  {
+    if (!check_coord(area.xCrd, area.yCrd, area.width, area.height))
+    {
+      return Status::COORD_ERROR;
+    }
+
+    DrawOp op;
+    op.type = DrawOpType::BOX;
+    op.area = area;
+    op.color = color;
+    op.image = NULL;
+    op.text[0] = '\0';
+
+    return push(op);
+  }
+
+  Status DrawQueue::image(DynamicArea area, const uint8_t *image)
+  {
+    if (!check_coord(area.xCrd, area.yCrd, area.width, area.height))
+    {
+      return Status::COORD_ERROR;
+    }
+
+    DrawOp op;
+    op.type = DrawOpType::IMAGE;
+    op.area = area;
+    op.color = Color::BLACK;
+    op.image = image;
+    op.text[0] = '\0';
+
+    return push(op);
+  }
+
+  Status DrawQueue::label(const char *text, uint8_t x, uint8_t y, const uint8_t *font, Color color)
+  {
+    if (text == NULL || font == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    if (x >= OLED_SCREEN_WIDTH || y >= OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    // the width is only known once laid out, so the area of a label
+    // reaches the right edge of the screen
+    uint8_t height = font[6];
+    if (height > OLED_SCREEN_HEIGHT - y)
+    {
+      height = OLED_SCREEN_HEIGHT - y;
+    }
+
+    DrawOp op;
+    op.type = DrawOpType::LABEL;
+    op.area.xCrd = x;
+    op.area.yCrd = y;
+    op.area.width = OLED_SCREEN_WIDTH - x;
+    op.area.height = height;
+    op.color = color;
+    op.image = font;
+
+    uint8_t length = 0;
+    while (text[length] != '\0')
+    {
+      if (length == OLED_LABEL_MAX_CHARS)
+      {
+        return Status::TEXT_OVERFLOW;
+      }
+      op.text[length] = text[length];
+      length++;
+    }
+    op.text[length] = '\0';
+
+    return push(op);
+  }
+
+  uint16_t DrawQueue::process(DrawOpFailed failed, void *context)
+  {
+    // take what is queued now; later operations wait for the next call
+    uint8_t count = 0;
+    while (count < OLED_DRAW_QUEUE_SIZE && pop(&_batch[count]))
+    {
+      count++;
+    }
+
+    // walk the batch backwards: an operation is hidden when a later
+    // opaque one covers its whole area; labels hide nothing since they
+    // only cover their text
+    bool hidden[OLED_DRAW_QUEUE_SIZE];
+    uint8_t covers[OLED_DRAW_QUEUE_SIZE];
+    uint8_t coverCount = 0;
+    for (int i = count - 1; i >= 0; i--)
+    {
+      const DrawOp &op = _batch[i];
+      hidden[i] = false;
+      for (uint8_t c = 0; c < coverCount; c++)
+      {
+        const DrawOp &cover = _batch[covers[c]];
+        if (area_contains(cover.area, op.area))
+        {
+          hidden[i] = true;
+          break;
+        }
+      }
+
+      if (!hidden[i] && op.type != DrawOpType::LABEL)
+      {
+        covers[coverCount++] = i;
+      }
+    }
+
+    uint16_t drawn = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      if (hidden[i])
+      {
+        continue;
+      }
+
+      Status status = run(_batch[i]);
+      if (status == Status::SUCCESS)
+      {
+        drawn++;
+      }
+      else if (failed != NULL)
+      {
+        failed(_batch[i], status, context);
+      }
+    }
+
+    return drawn;
+  }
+
+  Status DrawQueue::push(const DrawOp &op)
+  {
+    uint32_t pos = _tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true)
+    {
+      slot = &_slots[pos & (OLED_DRAW_QUEUE_SIZE - 1)];
+      uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(sequence - pos);
+      if (diff == 0)
+      {
+        // the slot is free: claim it
+        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (diff < 0)
+      {
+        // the slot still holds the operation of the previous lap
+        return Status::QUEUE_FULL;
+      }
+      else
+      {
+        // another producer claimed it first
+        pos = _tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->op = op;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    return Status::SUCCESS;
+  }
+
+  bool DrawQueue::pop(DrawOp *op)
+  {
+    Slot *slot = &_slots[_head & (OLED_DRAW_QUEUE_SIZE - 1)];
+    if (slot->sequence.load(std::memory_order_acquire) != _head + 1)
+    {
+      return false;
+    }
+
+    *op = slot->op;
+    slot->sequence.store(_head + OLED_DRAW_QUEUE_SIZE, std::memory_order_release);
+    _head++;
+
+    return true;
+  }
+
+  Status DrawQueue::run(const DrawOp &op)
+  {
+    Status status = Status::SUCCESS;
+    switch (op.type)
+    {
+    case DrawOpType::FILL:
+    {
+      status = _oled->fill_screen(op.color);
+      break;
+    }
+    case DrawOpType::BOX:
+    {
+      status = _oled->set_dynamic_area(op.area);
+      if (status == Status::SUCCESS)
+      {
+        status = _oled->draw_box(op.color);
+      }
+      break;
+    }
+    case DrawOpType::IMAGE:
+    {
+      status = _oled->set_dynamic_area(op.area);
+      if (status == Status::SUCCESS)
+      {
+        status = _oled->draw_image(op.image);
+      }
+      break;
+    }
+    case DrawOpType::LABEL:
+    {
+      // the font and color of the label only last for it
+      TextProperties saved;
+      _oled->get_text_properties(&saved);
+      bool changed = saved.font != op.image || saved.fontColor != op.color;
+      if (changed)
+      {
+        TextProperties prop = saved;
+        prop.font = op.image;
+        prop.fontColor = op.color;
+        _oled->set_text_properties(&prop);
+      }
+      status = _oled->label(op.text, op.area.xCrd, op.area.yCrd);
+      if (changed)
+      {
+        _oled->set_text_properties(&saved);
+      }
+      break;
+    }
+    }
+
+    return status;
+  }
+} // namespace oled
@@ -0,0 +1,88 @@
+/** OLED Draw Queue
+ *  This file contains the queue that lets many threads draw on the same
+ *  OLED: producers enqueue draw operations from any thread without locks,
+ *  and a single consumer runs them on the driver in order.
+ */
+
+#ifndef OLED_DRAW_QUEUE_H_
+#define OLED_DRAW_QUEUE_H_
+
+#include <atomic>
+#include <stdint.h>
+#include "oled_info.h"
+#include "oled_types.h"
+#include "oled_ssd1351.h"
+
+// number of operations the queue can hold, must be a power of two
+#define OLED_DRAW_QUEUE_SIZE (16)
+
+namespace oled
+{
+  enum class DrawOpType : uint8_t
+  {
+    FILL,  // fill the screen with a color
+    BOX,   // fill an area with a color
+    IMAGE, // draw an image in an area
+    LABEL  // write a text at a position
+  };
+
+  // Represent a queued draw operation
+  struct DrawOp
+  {
+    DrawOpType type;
+    DynamicArea area;           // the area covered; a LABEL reaches the right edge
+    Color color;                // the color for FILL and BOX, the font color for LABEL
+    const uint8_t *image;       // the image for IMAGE, the font for LABEL
+    char text[OLED_LABEL_MAX_CHARS + 1];
+  };
+
+  // Function called by process() for each operation the driver rejected
+  typedef void (*DrawOpFailed)(const DrawOp &op, Status status, void *context);
+
+  class DrawQueue
+  {
+  public:
+    // Queue operations for the given driver
+    // The driver must then be used only through the queue
+    DrawQueue(SSD1351 *oled);
+
+    // Functions to enqueue operations, safe from any thread
+    // They return QUEUE_FULL when the consumer is behind
+    Status fill(Color color);
+    Status box(DynamicArea area, Color color);
+
+    // The image is not copied: it must stay valid until it is drawn
+    Status image(DynamicArea area, const uint8_t *image);
+
+    // The text is copied, up to OLED_LABEL_MAX_CHARS characters
+    Status label(const char *text, uint8_t x, uint8_t y, const uint8_t *font, Color color);
+
+    // Run the queued operations on the driver; call it from one thread only
+    // Operations hidden by a later fill, box or image of the same batch
+    // are dropped; the ones the driver rejects, such as a label too wide
+    // for the screen, are passed to failed with their status
+    // Returns the number of operations drawn
+    uint16_t process(DrawOpFailed failed = NULL, void *context = NULL);
+
+  private:
+    struct Slot
+    {
+      std::atomic<uint32_t> sequence;
+      DrawOp op;
+    };
+
+    SSD1351 *_oled;
+    Slot _slots[OLED_DRAW_QUEUE_SIZE];
+    std::atomic<uint32_t> _tail;
+    uint32_t _head;
+
+    // Operations taken by process(), owned by the consumer
+    DrawOp _batch[OLED_DRAW_QUEUE_SIZE];
+
+    Status push(const DrawOp &op);
+    bool pop(DrawOp *op);
+    Status run(const DrawOp &op);
+  };
+} // namespace oled
+
+#endif // OLED_DRAW_QUEUE_H_
@@ -0,0 +1,49 @@
+/** OLED Event
+ *  This file contains the event a thread blocks on until another thread,
+ *  or an interrupt, signals that some work is done.
+ */
+
+#include "oled_event.h"
+
+namespace oled
+{
+#if defined(__MBED__)
+  // flag raised by set()
+  #define EVENT_FLAG_SET (1)
+
+  Event::Event()
+  {
+  }
+
+  void Event::set()
+  {
+    _flags.set(EVENT_FLAG_SET);
+  }
+
+  void Event::wait()
+  {
+    _flags.wait_any(EVENT_FLAG_SET);
+  }
+#else
+  Event::Event() : _set(false)
+  {
+  }
+
+  void Event::set()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _set = true;
+    }
+    _wake.notify_one();
+  }
+
+  void Event::wait()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _wake.wait(lock, [this]()
+               { return _set; });
+    _set = false;
+  }
+#endif
+} // namespace oled
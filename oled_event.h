@@ -0,0 +1,41 @@
+/** OLED Event
+ *  This file contains the event a thread blocks on until another thread,
+ *  or an interrupt, signals that some work is done.
+ */
+
+#ifndef OLED_EVENT_H_
+#define OLED_EVENT_H_
+
+#if defined(__MBED__)
+#include "mbed.h"
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace oled
+{
+  class Event
+  {
+  public:
+    Event();
+
+    // Wake up the waiting thread; safe from interrupt context on Mbed-OS
+    // A signal with nobody waiting is kept for the next wait()
+    void set();
+
+    // Block until the event is set, then clear it
+    void wait();
+
+  private:
+#if defined(__MBED__)
+    rtos::EventFlags _flags;
+#else
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _set;
+#endif
+  };
+} // namespace oled
+
+#endif // OLED_EVENT_H_
@@ -0,0 +1,151 @@
+/** OLED Glyph Cache
+ *  This file contains the cache of the glyphs already expanded from
+ *  the packed font bitmaps into horizontal runs of pixels.
+ */
+
+#include <stdlib.h>
+#include "oled_glyph_cache.h"
+
+namespace oled
+{
+  // count the runs of lit pixels of a packed bitmap: rows are byte
+  // aligned, LSB first
+  static uint16_t count_spans(const uint8_t *bitmap, uint8_t width, uint8_t height)
+  {
+    uint16_t spanCount = 0;
+    for (uint8_t y = 0; y < height; y++)
+    {
+      bool inSpan = false;
+      for (uint8_t x = 0; x < width; x++)
+      {
+        bool lit = (bitmap[x >> 3] >> (x & 7)) & 1;
+        if (lit && !inSpan)
+        {
+          spanCount++;
+        }
+        inSpan = lit;
+      }
+      bitmap += (width + 7) >> 3;
+    }
+    return spanCount;
+  }
+
+  GlyphCache::GlyphCache() : _slots(NULL),
+                             _slot_count(0),
+                             _used(0),
+                             _tick(0)
+  {
+  }
+
+  GlyphCache::~GlyphCache()
+  {
+#if !OLED_STATIC_BUFFERS
+    free(_slots);
+#endif
+  }
+
+  void GlyphCache::resize(uint8_t slots)
+  {
+#if OLED_STATIC_BUFFERS
+    _slots = _storage;
+    _slot_count = slots < OLED_GLYPH_CACHE_STATIC_SLOTS ? slots : OLED_GLYPH_CACHE_STATIC_SLOTS;
+#else
+    free(_slots);
+    _slots = NULL;
+    if (slots > 0)
+    {
+      _slots = (CachedGlyph *)malloc(sizeof(CachedGlyph) * slots);
+    }
+    _slot_count = _slots != NULL ? slots : 0;
+#endif
+    _used = 0;
+  }
+
+  const CachedGlyph *GlyphCache::find(const uint8_t *font, char character, pixel_t color)
+  {
+    for (uint8_t i = 0; i < _used; i++)
+    {
+      CachedGlyph *glyph = &_slots[i];
+      if (glyph->character == character && glyph->color == color && glyph->font == font)
+      {
+        glyph->lastUse = ++_tick;
+        return glyph;
+      }
+    }
+    return NULL;
+  }
+
+  const CachedGlyph *GlyphCache::insert(const uint8_t *font, char character, pixel_t color,
+                                        const uint8_t *bitmap, uint8_t width, uint8_t height)
+  {
+    // a glyph that can't be cached must not evict one that can
+    if (_slot_count == 0 || height > OLED_GLYPH_CACHE_MAX_HEIGHT ||
+        count_spans(bitmap, width, height) > OLED_GLYPH_CACHE_MAX_SPANS)
+    {
+      return NULL;
+    }
+
+    // pick a free slot or the least recently used one
+    CachedGlyph *glyph;
+    if (_used < _slot_count)
+    {
+      glyph = &_slots[_used++];
+    }
+    else
+    {
+      glyph = &_slots[0];
+      for (uint8_t i = 1; i < _slot_count; i++)
+      {
+        if (_slots[i].lastUse < glyph->lastUse)
+        {
+          glyph = &_slots[i];
+        }
+      }
+    }
+
+    // expand the packed bitmap: rows are byte aligned, LSB first
+    uint8_t spanCount = 0;
+    uint8_t foo = 0, mask;
+    for (uint8_t y = 0; y < height; y++)
+    {
+      glyph->rowStart[y] = spanCount;
+      mask = 0;
+      bool inSpan = false;
+      for (uint8_t x = 0; x < width; x++)
+      {
+        if (mask == 0)
+        {
+          mask = 1;
+          foo = *bitmap++;
+        }
+
+        if ((foo & mask) != 0)
+        {
+          if (!inSpan)
+          {
+            glyph->spans[spanCount].x = x;
+            glyph->spans[spanCount].length = 0;
+            spanCount++;
+            inSpan = true;
+          }
+          glyph->spans[spanCount - 1].length++;
+        }
+        else
+        {
+          inSpan = false;
+        }
+        mask <<= 1;
+      }
+    }
+    glyph->rowStart[height] = spanCount;
+
+    glyph->font = font;
+    glyph->character = character;
+    glyph->color = color;
+    glyph->width = width;
+    glyph->height = height;
+    glyph->lastUse = ++_tick;
+
+    return glyph;
+  }
+} // namespace oled
@@ -0,0 +1,77 @@
+/** OLED Glyph Cache
+ *  This file contains the cache of the glyphs already expanded from
+ *  the packed font bitmaps into horizontal runs of pixels.
+ */
+
+#ifndef OLED_GLYPH_CACHE_H_
+#define OLED_GLYPH_CACHE_H_
+
+#include <stdint.h>
+#include "oled_types.h"
+#include "oled_info.h"
+
+// max glyph height that can be cached
+#define OLED_GLYPH_CACHE_MAX_HEIGHT (24)
+
+// max number of runs in a cached glyph
+#define OLED_GLYPH_CACHE_MAX_SPANS (48)
+
+// number of glyph slots reserved when OLED_STATIC_BUFFERS is set
+#ifndef OLED_GLYPH_CACHE_STATIC_SLOTS
+#define OLED_GLYPH_CACHE_STATIC_SLOTS (16)
+#endif
+
+namespace oled
+{
+  // Represent a horizontal run of lit pixels in a glyph row
+  struct GlyphSpan
+  {
+    uint8_t x;
+    uint8_t length;
+  };
+
+  // Represent a glyph expanded in runs with its color already swapped
+  struct CachedGlyph
+  {
+    const uint8_t *font;
+    char character;
+    pixel_t color;
+    uint8_t width;
+    uint8_t height;
+    uint32_t lastUse;
+    // spans of row y are in [rowStart[y], rowStart[y + 1])
+    uint8_t rowStart[OLED_GLYPH_CACHE_MAX_HEIGHT + 1];
+    GlyphSpan spans[OLED_GLYPH_CACHE_MAX_SPANS];
+  };
+
+  class GlyphCache
+  {
+  public:
+    GlyphCache();
+    ~GlyphCache();
+
+    // Set the max number of cached glyphs, 0 disables the cache
+    // Resizing drops every cached glyph; with OLED_STATIC_BUFFERS the
+    // number of slots is capped to OLED_GLYPH_CACHE_STATIC_SLOTS
+    void resize(uint8_t slots);
+
+    // Look for a glyph in the cache; return NULL on miss
+    const CachedGlyph *find(const uint8_t *font, char character, pixel_t color);
+
+    // Expand a glyph from its packed bitmap and store it in the cache,
+    // evicting the least recently used one; return NULL if it can't be cached
+    const CachedGlyph *insert(const uint8_t *font, char character, pixel_t color,
+                              const uint8_t *bitmap, uint8_t width, uint8_t height);
+
+  private:
+    CachedGlyph *_slots;
+    uint8_t _slot_count;
+    uint8_t _used;
+    uint32_t _tick;
+#if OLED_STATIC_BUFFERS
+    CachedGlyph _storage[OLED_GLYPH_CACHE_STATIC_SLOTS];
+#endif
+  };
+} // namespace oled
+
+#endif // OLED_GLYPH_CACHE_H_
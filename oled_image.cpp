@@ -0,0 +1,119 @@
+/** OLED Compressed Image
+ *  This file contains the compressed image format and its streaming
+ *  decoder, which expands the pixels a few at a time into any buffer.
+ */
+
+#include "oled_image.h"
+
+namespace oled
+{
+  ImageDecoder::ImageDecoder() : _image(NULL),
+                                 _next(NULL),
+                                 _left(0),
+                                 _count(0),
+                                 _run(false),
+                                 _value(0),
+                                 _high_nibble(false)
+  {
+  }
+
+  void ImageDecoder::start(const CompressedImage *image)
+  {
+    _image = image;
+    _next = image->data;
+    _left = (uint32_t)image->width * image->height;
+    _count = 0;
+    _run = false;
+    _value = 0;
+    _high_nibble = false;
+  }
+
+  uint32_t ImageDecoder::read(pixel_t *buffer, uint32_t pixels)
+  {
+    if (pixels > _left)
+    {
+      pixels = _left;
+    }
+
+    uint32_t done = 0;
+    while (done < pixels)
+    {
+      if (_count == 0)
+      {
+        // start the next packet
+        uint8_t control = *_next++;
+        _count = (control & ~OLED_IMAGE_RUN_FLAG) + 1;
+        _run = (control & OLED_IMAGE_RUN_FLAG) != 0;
+        _high_nibble = false;
+        if (_run)
+        {
+          if (_image->encoding == ImageEncoding::RLE)
+          {
+            _value = _next[0] | (_next[1] << 8);
+            _next += 2;
+          }
+          else
+          {
+            _value = _image->palette[*_next++];
+          }
+        }
+      }
+
+      uint32_t count = pixels - done;
+      if (count > _count)
+      {
+        count = _count;
+      }
+
+      if (_run)
+      {
+        for (uint32_t i = 0; i < count; i++)
+        {
+          buffer[done + i] = _value;
+        }
+      }
+      else if (_image->encoding == ImageEncoding::RLE)
+      {
+        for (uint32_t i = 0; i < count; i++)
+        {
+          buffer[done + i] = _next[0] | (_next[1] << 8);
+          _next += 2;
+        }
+      }
+      else if (_image->encoding == ImageEncoding::PALETTE_256)
+      {
+        for (uint32_t i = 0; i < count; i++)
+        {
+          buffer[done + i] = _image->palette[*_next++];
+        }
+      }
+      else
+      {
+        for (uint32_t i = 0; i < count; i++)
+        {
+          if (_high_nibble)
+          {
+            buffer[done + i] = _image->palette[*_next++ >> 4];
+          }
+          else
+          {
+            buffer[done + i] = _image->palette[*_next & 0x0F];
+          }
+          _high_nibble = !_high_nibble;
+        }
+      }
+
+      _count -= count;
+      done += count;
+
+      // the indexes of a packet end on a byte boundary
+      if (_count == 0 && _high_nibble)
+      {
+        _next++;
+      }
+    }
+
+    _left -= done;
+    return done;
+  }
+} // namespace oled
@@ -0,0 +1,73 @@
+/** OLED Compressed Image
+ *  This file contains the compressed image format and its streaming
+ *  decoder, which expands the pixels a few at a time into any buffer.
+ *
+ *  The pixels are stored row by row as packets; each packet starts with
+ *  a control byte n:
+ *  - n & 0x80 set: a run of (n & 0x7F) + 1 pixels of the value that follows
+ *  - n & 0x80 clear: n + 1 literal values follow
+ *
+ *  A value is a pixel in the byte order of the raw images for RLE, or an
+ *  index in the palette for the palette encodings. PALETTE_16 packs two
+ *  literal indexes per byte, low nibble first; a run index takes a byte.
+ *
+ *  Images are generated by host/image_compiler.cpp.
+ */
+
+#ifndef OLED_IMAGE_H_
+#define OLED_IMAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "oled_types.h"
+
+// flag of the control byte of a run packet
+#define OLED_IMAGE_RUN_FLAG (0x80)
+// max number of pixels in a packet
+#define OLED_IMAGE_PACKET_MAX (128)
+
+namespace oled
+{
+  enum class ImageEncoding : uint8_t
+  {
+    RLE,        // runs and literals of RGB565 pixels
+    PALETTE_16, // runs and literals of 4-bit palette indexes
+    PALETTE_256 // runs and literals of 8-bit palette indexes
+  };
+
+  // Represent a compressed image
+  struct CompressedImage
+  {
+    uint8_t width;
+    uint8_t height;
+    ImageEncoding encoding;
+    const pixel_t *palette; // in the byte order of the screen buffer, NULL for RLE
+    const uint8_t *data;
+  };
+
+  class ImageDecoder
+  {
+  public:
+    ImageDecoder();
+
+    // Start decoding the given image from its first pixel
+    void start(const CompressedImage *image);
+
+    // Expand the next pixels of the image in the given buffer
+    // Returns the number of pixels written, less than asked at the end
+    uint32_t read(pixel_t *buffer, uint32_t pixels);
+
+  private:
+    const CompressedImage *_image;
+    const uint8_t *_next;
+    uint32_t _left;
+
+    // Packet being decoded
+    uint8_t _count;
+    bool _run;
+    pixel_t _value;
+    bool _high_nibble;
+  };
+} // namespace oled
+
+#endif // OLED_IMAGE_H_
@@ -0,0 +1,25 @@
+/** OLED Image Source
+ *  This file contains the interface the driver pulls images from when
+ *  they are not in addressable memory: external flash, an SD card, a file.
+ */
+
+#ifndef OLED_IMAGE_SOURCE_H_
+#define OLED_IMAGE_SOURCE_H_
+
+#include <stdint.h>
+
+namespace oled
+{
+  class ImageSource
+  {
+  public:
+    virtual ~ImageSource() {}
+
+    // Copy the next bytes of the image in the given buffer
+    // The bytes are raw pixels, row by row, in the order of the image
+    // arrays; returns the number of bytes copied, 0 at the end or on error
+    virtual uint32_t read(uint8_t *buffer, uint32_t size) = 0;
+  };
+} // namespace oled
+
+#endif // OLED_IMAGE_SOURCE_H_
@@ -45,12 +45,60 @@
 #define OLED_SCREEN_WIDTH (96)
 #define OLED_SCREEN_HEIGHT (96)
 
+// Set to 1 to take every buffer from storage inside the driver object
+// instead of the heap; the object then takes about 21 KB, so declare it
+// as a global or static variable
+#ifndef OLED_STATIC_BUFFERS
+#define OLED_STATIC_BUFFERS (0)
+#endif
+
+// Set to 1 to build the renderer: the application draws into a back
+// buffer while a display thread sends the front one; on Mbed-OS it needs
+// the RTOS, and with OLED_STATIC_BUFFERS the object takes 19 KB more,
+// the stack of the display thread included
+#ifndef OLED_RENDERER
+#define OLED_RENDERER (0)
+#endif
+
+// Set to 1 to draw the fonts that have a span-encoded version from it;
+// the span fonts are linked next to the original ones and take 3.8 KB
+// more of flash for the two OpenSans fonts
+#ifndef OLED_SPAN_FONTS
+#define OLED_SPAN_FONTS (0)
+#endif
+
+// stack size in bytes of the display thread on Mbed-OS
+#define OLED_RENDERER_STACK_SIZE (1024)
+
 // OLED offset
 #define OLED_COLUMN_OFFSET (16)
 #define OLED_ROW_OFFSET (0)
 
+// OLED RAM rows; the ones not displayed are used by the scroll transitions
+#define OLED_RAM_ROWS (128)
+#define OLED_RAM_SPARE_ROWS (OLED_RAM_ROWS - OLED_SCREEN_HEIGHT)
+
 #define OLED_TRANSITION_STEP (1)
 
+// number of full rows read from an image source and sent at once
+#define OLED_STREAM_BATCH_ROWS (8)
+
+// number of pixels streamed at once by solid fills
+#define OLED_FILL_BURST_SIZE (32)
+
+// size in pixels of the square tiles compared by the diff mode
+#define OLED_DIFF_TILE_SIZE (8)
+#define OLED_DIFF_TILE_COLUMNS (OLED_SCREEN_WIDTH / OLED_DIFF_TILE_SIZE)
+
+// unchanged pixels that join two pixel runs of a row, before the runs
+// are grown into windows
+#define OLED_PIXEL_RUN_GAP (4)
+// pixels worth sending to save a window setup: its seven command bytes,
+// the chip selects and the D/C changes around them
+#define OLED_WINDOW_SETUP_PIXELS (16)
+// max number of windows growing at once while pixels are sent
+#define OLED_PIXEL_WINDOWS_MAX (16)
+
 // text stuff
 #define OLED_CHAR_WIDTH_AUTO (0xFF)
 #define OLED_CHAR_WIDTH_MAX (0xFE)
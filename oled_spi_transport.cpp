@@ -0,0 +1,102 @@
+/** OLED SPI Transport
+ *  This file contains the Mbed-OS SPI implementation of the OLED transport.
+ */
+
+#include "oled_spi_transport.h"
+
+namespace oled
+{
+  SPITransport::SPITransport(PinName mosiPin, PinName sclkPin,
+                             PinName pwrPin, PinName csPin,
+                             PinName rstPin, PinName dcPin) : _spi(mosiPin, NC, sclkPin),
+                                                              _power(pwrPin),
+                                                              _cs(csPin),
+                                                              _rst(rstPin),
+                                                              _dc(dcPin),
+                                                              _callback(NULL),
+                                                              _context(NULL)
+  {
+    _spi.frequency(OLED_SPI_FREQUENCY);
+#if DEVICE_SPI_ASYNCH
+    _spi.set_dma_usage(DMA_USAGE_OPPORTUNISTIC);
+#endif
+    _cs = 1;
+    _dc = 0;
+  }
+
+  void SPITransport::set_power(bool on)
+  {
+    _power = on ? 1 : 0;
+  }
+
+  void SPITransport::set_reset(bool active)
+  {
+    _rst = active ? 0 : 1;
+  }
+
+  void SPITransport::sleep_ms(uint32_t ms)
+  {
+    ThisThread::sleep_for(std::chrono::milliseconds(ms));
+  }
+
+  void SPITransport::select()
+  {
+    _cs = 0;
+  }
+
+  void SPITransport::deselect()
+  {
+    _cs = 1;
+  }
+
+  void SPITransport::set_data_mode(bool data)
+  {
+    _dc = data ? 1 : 0;
+  }
+
+  void SPITransport::write(const uint8_t *data, uint32_t size)
+  {
+    // a single byte is faster with the plain write
+    if (size == 1)
+    {
+      _spi.write(*data);
+      return;
+    }
+
+    // stream the buffer in bursts, the rx side is discarded
+    while (size > 0)
+    {
+      uint32_t burst = size > OLED_SPI_BURST_SIZE ? OLED_SPI_BURST_SIZE : size;
+      _spi.write((const char *)data, (int)burst, NULL, 0);
+      data += burst;
+      size -= burst;
+    }
+  }
+
+  void SPITransport::write_async(const uint8_t *data, uint32_t size,
+                                 TransferCallback callback, void *context)
+  {
+#if DEVICE_SPI_ASYNCH
+    _callback = callback;
+    _context = context;
+    _spi.transfer(data, (int)size, (uint8_t *)NULL, 0,
+                  mbed::callback(this, &SPITransport::on_transfer_event),
+                  SPI_EVENT_COMPLETE);
+#else
+    // no asynch support on this target, fall back to a blocking write
+    write(data, size);
+    callback(context);
+#endif
+  }
+
+  void SPITransport::on_transfer_event(int event)
+  {
+    (void)event;
+    TransferCallback callback = _callback;
+    _callback = NULL;
+    if (callback != NULL)
+    {
+      callback(_context);
+    }
+  }
+} // namespace oled
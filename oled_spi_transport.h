@@ -0,0 +1,52 @@
+/** OLED SPI Transport
+ *  This file contains the Mbed-OS SPI implementation of the OLED transport.
+ */
+
+#ifndef OLED_SPI_TRANSPORT_H_
+#define OLED_SPI_TRANSPORT_H_
+
+#include "mbed.h"
+#include "oled_transport.h"
+
+// max number of bytes sent with a single SPI bulk write
+#define OLED_SPI_BURST_SIZE (1024)
+
+// SPI clock frequency used to drive the OLED
+#define OLED_SPI_FREQUENCY (8000000)
+
+namespace oled
+{
+  class SPITransport : public Transport
+  {
+  public:
+    SPITransport(PinName mosiPin, PinName sclkPin,
+                 PinName pwrPin, PinName csPin,
+                 PinName rstPin, PinName dcPin);
+
+    void set_power(bool on) override;
+    void set_reset(bool active) override;
+    void sleep_ms(uint32_t ms) override;
+    void select() override;
+    void deselect() override;
+    void set_data_mode(bool data) override;
+    void write(const uint8_t *data, uint32_t size) override;
+    void write_async(const uint8_t *data, uint32_t size,
+                     TransferCallback callback, void *context) override;
+
+  private:
+    SPI _spi;
+    DigitalOut _power;
+    DigitalOut _cs;
+    DigitalOut _rst;
+    DigitalOut _dc;
+
+    // Pending asynchronous transfer
+    TransferCallback _callback;
+    void *_context;
+
+    // Called by the SPI driver at the end of a transfer
+    void on_transfer_event(int event);
+  };
+} // namespace oled
+
+#endif // OLED_SPI_TRANSPORT_H_
@@ -34,11 +34,71 @@
  * Rewrite by Lorenzo Calisti, 2022
  */
 
-#include "oled_SSD1351.h"
+#include "oled_ssd1351.h"
 #include "font/opensans_font.h"
+#include "font/span_font.h"
+#include "font/alpha_font.h"
 
 namespace oled
 {
+  // Check if a row of a diff tile changed
+  // Pixels are compared a word at a time; the image may be unaligned
+  static bool tile_row_changed(const uint8_t *a, const uint8_t *b)
+  {
+    uint32_t diff = 0;
+    for (size_t i = 0; i < OLED_DIFF_TILE_SIZE * sizeof(pixel_t); i += sizeof(uint32_t))
+    {
+      uint32_t wa, wb;
+      memcpy(&wa, a + i, sizeof(uint32_t));
+      memcpy(&wb, b + i, sizeof(uint32_t));
+      diff |= wa ^ wb;
+    }
+    return diff != 0;
+  }
+
+  // Blend two RGB565 colors, alpha from 0 (bg) to 32 (fg)
+  // The channels are spread over a word, with room for the products
+  // between them, so a single multiply blends all three
+  static pixel_t blend_color(pixel_t fg, pixel_t bg, uint32_t alpha)
+  {
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t mix = ((f * alpha + b * (32 - alpha)) >> 5) & 0x07E0F81F;
+    return (pixel_t)(mix | (mix >> 16));
+  }
+
+  // Smallest area holding both areas
+  static DynamicArea bounding_box(const DynamicArea &a, const DynamicArea &b)
+  {
+    uint8_t x0 = a.xCrd < b.xCrd ? a.xCrd : b.xCrd;
+    uint8_t y0 = a.yCrd < b.yCrd ? a.yCrd : b.yCrd;
+    uint8_t x1 = a.xCrd + a.width > b.xCrd + b.width ? a.xCrd + a.width : b.xCrd + b.width;
+    uint8_t y1 = a.yCrd + a.height > b.yCrd + b.height ? a.yCrd + a.height : b.yCrd + b.height;
+    DynamicArea box = {
+        .xCrd = x0,
+        .yCrd = y0,
+        .width = (uint8_t)(x1 - x0),
+        .height = (uint8_t)(y1 - y0)};
+    return box;
+  }
+
+  static int32_t area_pixels(const DynamicArea &area)
+  {
+    return (int32_t)area.width * area.height;
+  }
+
+  // FNV-1a hash of a text, telling a text changed in place from the one
+  // laid out before
+  static uint32_t hash_text(const char *text)
+  {
+    uint32_t hash = 2166136261u;
+    while (*text != 0)
+    {
+      hash = (hash ^ (uint8_t)*text++) * 16777619u;
+    }
+    return hash;
+  }
+
   const Command seq[] = {
       OLED_CMD_SET_CMD_LOCK, CMD_BYTE,
       OLED_UNLOCK, DATA_BYTE,
@@ -80,23 +140,79 @@ namespace oled
       0x01, DATA_BYTE,
       OLED_CMD_SET_SLEEP_MODE_OFF, CMD_BYTE};
 
+#if defined(__MBED__)
   SSD1351::SSD1351(PinName mosiPin, PinName sclkPin,
                    PinName pwrPin, PinName csPin,
-                   PinName rstPin, PinName dcPin) : _spi(mosiPin, NC, sclkPin),
-                                                    _power(pwrPin),
-                                                    _cs(csPin),
-                                                    _rst(rstPin),
-                                                    _dc(dcPin)
+                   PinName rstPin, PinName dcPin) : _own_transport(new SPITransport(mosiPin, sclkPin,
+                                                                                     pwrPin, csPin,
+                                                                                     rstPin, dcPin))
+  {
+    _transport = _own_transport;
+    init();
+  }
+#endif
+
+  SSD1351::SSD1351(Transport *transport) : _own_transport(NULL),
+                                           _transport(transport)
+  {
+    init();
+  }
+
+  SSD1351::~SSD1351(void)
   {
-    _spi.frequency(8000000);
+#if OLED_RENDERER
+    stop_renderer();
+#endif
+    wait_transfer();
+#if !OLED_STATIC_BUFFERS
+    free(_screen_buffer);
+#endif
+    delete _own_transport;
+  }
 
-    _dc = 0;
+  void SSD1351::init()
+  {
+    _area_set = false;
+    _retained = false;
+    _diff = false;
+    memset(_touched, 0, sizeof(_touched));
+    _antialias = false;
+    for (uint8_t i = 0; i < OLED_TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+      _layout_cache[i].layout.text = NULL;
+    }
+    _layout_next = 0;
+    _blend_fg = 0;
+    _blend_bg = 0;
+    _blend_valid = 0;
+    _row_base = 0;
+    _window_base = 0;
+    _window_split = false;
+    _window_part = 0;
+    _window_left = 0;
+    _scene_image = NULL;
+    _scene_color = 0;
+    _layer_count = 0;
+    _screen_synced = false;
+    _claimed = false;
+    _busy = false;
+    _user_callback = NULL;
+    _user_context = NULL;
+#if OLED_RENDERER
+    _rendering = false;
+    _presenting = false;
+    _front_buffer = NULL;
+    _frame_count = 0;
+    _frame_row_base = 0;
+#endif
+
+    _transport->set_data_mode(false);
     power_off();
-    ThisThread::sleep_for(1ms);
-    _rst = 0;
-    ThisThread::sleep_for(1ms);
-    _rst = 1;
-    ThisThread::sleep_for(1ms);
+    _transport->sleep_ms(1);
+    _transport->set_reset(true);
+    _transport->sleep_ms(1);
+    _transport->set_reset(false);
+    _transport->sleep_ms(1);
     power_on();
 
     // reset text prop
@@ -111,76 +227,220 @@ namespace oled
     _dynamic_area.yCrd = 0;
     _dynamic_area.width = OLED_SCREEN_WIDTH;
     _dynamic_area.height = OLED_SCREEN_HEIGHT;
+#if OLED_STATIC_BUFFERS
+    _screen_buffer = _screen_storage;
+#else
     _screen_buffer = (pixel_t *)malloc(OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
+#endif
 
     // send init commands to OLED
-    for (int i = 0; i < 39; i++)
+    CommandList init;
+    for (size_t i = 0; i < sizeof(seq) / sizeof(seq[0]); i++)
     {
-      send_cmd(seq[i]);
+      init.add(seq[i]);
     }
+    send_cmds(init);
+
+    // the contrast the init sequence sets, which set_contrast() compares to
+    _contrast.master = 0x0F;
+    _contrast.a = 0x8A;
+    _contrast.b = 0x51;
+    _contrast.c = 0x8A;
   }
 
-  SSD1351::~SSD1351(void)
+  void SSD1351::dim_screen_on()
   {
-    free(_screen_buffer);
-    if (_area_buffer != NULL)
-    {
-      free(_area_buffer);
-    }
+    Contrast contrast = _contrast;
+    contrast.master = 0;
+    set_contrast(contrast);
   }
 
-  void SSD1351::dim_screen_on()
+  void SSD1351::dim_screen_off()
+  {
+    Contrast contrast = _contrast;
+    contrast.master = 0xF;
+    set_contrast(contrast);
+  }
+
+  void SSD1351::set_contrast(const Contrast &contrast)
   {
-    for (int i = 0; i < 16; i++)
+    CommandList commands;
+    if (contrast.master != _contrast.master)
+    {
+      commands.add({OLED_CMD_CONTRASTMASTER, CMD_BYTE})
+          .add({(uint32_t)(0xC0 | (contrast.master & 0xF)), DATA_BYTE});
+    }
+    if (contrast.a != _contrast.a || contrast.b != _contrast.b || contrast.c != _contrast.c)
     {
-      send_cmd({OLED_CMD_CONTRASTMASTER, CMD_BYTE});
-      send_cmd({(uint32_t)(0xC0 | (0xF - i)), DATA_BYTE});
-      ThisThread::sleep_for(20ms);
+      commands.add({OLED_CMD_CONTRASTABC, CMD_BYTE})
+          .add({contrast.a, DATA_BYTE})
+          .add({contrast.b, DATA_BYTE})
+          .add({contrast.c, DATA_BYTE});
+    }
+    _contrast = contrast;
+
+    if (commands.size() > 0)
+    {
+      send_cmds(commands);
     }
   }
 
-  void SSD1351::dim_screen_off()
+  void SSD1351::get_contrast(Contrast *contrast)
   {
-    send_cmd({OLED_CMD_CONTRASTMASTER, CMD_BYTE});
-    send_cmd({0xC0 | 0xF, DATA_BYTE});
+    *contrast = _contrast;
   }
 
   void SSD1351::power_on()
   {
-    _power = 1;
+    _transport->set_power(true);
   }
 
   void SSD1351::power_off()
   {
-    _power = 0;
+    _transport->set_power(false);
   }
 
   Status SSD1351::set_dynamic_area(DynamicArea area)
   {
+    // never touch the buffers while they are being sent
+    wait_transfer();
+
     // check if given area is valid
     if (!check_coord(area.xCrd, area.yCrd, area.width, area.height))
     {
       return Status::COORD_ERROR;
     }
 
-    // allocate area buffer
-    if (_area_buffer == NULL)
+    _area_set = true;
+
+    // set the coordinates and border
+    _dynamic_area = area;
+    if (!_retained)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
+
+    return Status::SUCCESS;
+  }
+
+  void SSD1351::set_retained_mode(bool enable)
+  {
+#if OLED_RENDERER
+    // the renderer needs the retained mode until it stops
+    if (_rendering)
     {
-      _area_buffer = (pixel_t *)malloc(sizeof(pixel_t) * area.width * area.height);
+      return;
     }
-    else if (area.width != _dynamic_area.width || area.height != _dynamic_area.height)
+#endif
+
+    if (_retained == enable)
     {
-      free(_area_buffer);
-      _area_buffer = (pixel_t *)malloc(sizeof(pixel_t) * area.width * area.height);
+      return;
     }
 
-    // set the coordinates and border
-    _dynamic_area = area;
-    set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    if (!enable)
+    {
+      // send what is pending and restore the window of the dynamic area
+      flush();
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
+    _retained = enable;
+  }
+
+  Status SSD1351::flush()
+  {
+    for (uint8_t i = 0; i < _dirty.count(); i++)
+    {
+      draw_screen_window(_dirty.get(i));
+    }
+    _dirty.clear();
+
+    return Status::SUCCESS;
+  }
+
+#if OLED_RENDERER
+  void SSD1351::start_renderer()
+  {
+    if (_rendering)
+    {
+      return;
+    }
+
+    set_retained_mode(true);
+#if OLED_STATIC_BUFFERS
+    _front_buffer = _front_storage;
+#else
+    _front_buffer = (pixel_t *)malloc(OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
+#endif
+    _rendering = true;
+    _display_thread.start(&SSD1351::on_display_work, this);
+  }
+
+  Status SSD1351::present()
+  {
+    if (!_rendering)
+    {
+      return flush();
+    }
+
+    // the front buffer is free again once the previous frame is sent
+    // Only the changed areas are copied; swapping the buffers instead
+    // would leave the back one a frame behind, and bringing it up to date
+    // takes the same copy of the changed areas
+    wait_display();
+    wait_transfer();
+
+    _frame_count = _dirty.count();
+    for (uint8_t i = 0; i < _frame_count; i++)
+    {
+      DynamicArea area = _dirty.get(i);
+      for (uint8_t y = area.yCrd; y < area.yCrd + area.height; y++)
+      {
+        memcpy(_front_buffer + y * OLED_SCREEN_WIDTH + area.xCrd,
+               _screen_buffer + y * OLED_SCREEN_WIDTH + area.xCrd,
+               area.width * sizeof(pixel_t));
+      }
+      _frame_rects[i] = area;
+    }
+    _frame_row_base = _row_base;
+    _dirty.clear();
+
+    if (_frame_count == 0)
+    {
+      return Status::SUCCESS;
+    }
+
+    // publish the frame; from now on it belongs to the display thread
+    _presenting = true;
+    _display_thread.signal();
 
     return Status::SUCCESS;
   }
 
+  void SSD1351::stop_renderer()
+  {
+    if (!_rendering)
+    {
+      return;
+    }
+
+    wait_display();
+    _display_thread.stop();
+    _rendering = false;
+#if !OLED_STATIC_BUFFERS
+    free(_front_buffer);
+#endif
+    _front_buffer = NULL;
+
+    set_retained_mode(false);
+  }
+#endif
+
+  void SSD1351::set_diff_mode(bool enable)
+  {
+    _diff = enable;
+  }
+
   Status SSD1351::fill_screen(Color color)
   {
     DynamicArea area = {
@@ -199,22 +459,30 @@ namespace oled
     {
       _screen_buffer[i] = swappedColor;
     }
+    _screen_synced = true;
 
-    draw_screen_buffer();
+    if (_retained)
+    {
+      draw_screen_buffer();
+    }
+    else
+    {
+      send_fill(swappedColor, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT);
+    }
 
     return Status::SUCCESS;
   }
 
   Status SSD1351::draw_image(const uint8_t *image)
   {
-    if (_area_buffer == NULL)
+    wait_transfer();
+    if (!_area_set)
     {
       return Status::AREA_NOT_SET;
     }
 
-    memcpy(_area_buffer, (pixel_t *)image, sizeof(pixel_t) * _dynamic_area.width * _dynamic_area.height);
-    update_screen_buffer(_area_buffer);
-    draw_area_buffer();
+    update_screen_buffer((const pixel_t *)image);
+    draw_area();
 
     return Status::SUCCESS;
   }
@@ -226,6 +494,23 @@ namespace oled
         .yCrd = 0,
         .width = OLED_SCREEN_WIDTH,
         .height = OLED_SCREEN_HEIGHT};
+
+    // the screen buffer must match the OLED for the diff to be meaningful
+    // The diff sends the changed tiles in windows of their own, so the
+    // full-screen window is only set up if it is not the dynamic area yet;
+    // a frame without changes then sends nothing
+    if (_diff && _screen_synced && transition == Transition::NONE)
+    {
+      wait_transfer();
+      if (!_area_set || _dynamic_area.xCrd != 0 || _dynamic_area.yCrd != 0 ||
+          _dynamic_area.width != OLED_SCREEN_WIDTH || _dynamic_area.height != OLED_SCREEN_HEIGHT)
+      {
+        set_dynamic_area(area);
+      }
+      draw_screen_diff(image);
+      return Status::SUCCESS;
+    }
+
     Status status = set_dynamic_area(area);
     if (status != Status::SUCCESS)
     {
@@ -233,13 +518,111 @@ namespace oled
     }
 
     memcpy(_screen_buffer, (pixel_t *)image, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
+    _screen_synced = true;
+
+    return draw_transition(transition);
+  }
+
+  Status SSD1351::draw_image(const CompressedImage *image)
+  {
+    wait_transfer();
+    if (!_area_set)
+    {
+      return Status::AREA_NOT_SET;
+    }
+    if (image->width != _dynamic_area.width || image->height != _dynamic_area.height)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    decode_area(image);
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::draw_screen(const CompressedImage *image, Transition transition)
+  {
+    if (image->width != OLED_SCREEN_WIDTH || image->height != OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    DynamicArea area = {
+        .xCrd = 0,
+        .yCrd = 0,
+        .width = OLED_SCREEN_WIDTH,
+        .height = OLED_SCREEN_HEIGHT};
+    Status status = set_dynamic_area(area);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+    _screen_synced = true;
+
+    if (transition == Transition::NONE)
+    {
+      decode_area(image);
+      return Status::SUCCESS;
+    }
+
+    // the transitions need the whole image in the screen buffer
+    ImageDecoder decoder;
+    decoder.start(image);
+    decoder.read(_screen_buffer, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT);
+
+    return draw_transition(transition);
+  }
+
+  Status SSD1351::draw_image(ImageSource *source)
+  {
+    wait_transfer();
+    if (!_area_set)
+    {
+      return Status::AREA_NOT_SET;
+    }
+
+    return stream_area(source);
+  }
+
+  Status SSD1351::draw_screen(ImageSource *source, Transition transition)
+  {
+    DynamicArea area = {
+        .xCrd = 0,
+        .yCrd = 0,
+        .width = OLED_SCREEN_WIDTH,
+        .height = OLED_SCREEN_HEIGHT};
+    Status status = set_dynamic_area(area);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+
+    if (transition == Transition::NONE)
+    {
+      status = stream_area(source);
+      _screen_synced = status == Status::SUCCESS;
+      return status;
+    }
+
+    // the transitions need the whole image in the screen buffer
+    if (!read_rows(source, 0, OLED_SCREEN_HEIGHT))
+    {
+      _screen_synced = false;
+      return Status::READ_ERROR;
+    }
+    _screen_synced = true;
+
+    return draw_transition(transition);
+  }
 
+  Status SSD1351::draw_transition(Transition transition)
+  {
     switch (transition)
     {
     case Transition::NONE:
     {
       draw_screen_buffer();
-      break;
+      return Status::SUCCESS;
     }
     case Transition::TOP_DOWN:
     {
@@ -261,25 +644,116 @@ namespace oled
       draw_screen_right_left();
       break;
     }
+    case Transition::SCROLL_TOP_DOWN:
+    {
+      draw_screen_scroll_top_down();
+      break;
+    }
+    case Transition::SCROLL_DOWN_TOP:
+    {
+      draw_screen_scroll_down_top();
+      break;
+    }
+    }
+
+    // transitions are always sent at once and leave the OLED in sync
+    _dirty.clear();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::draw_screen_async(const uint8_t *image, TransferCallback callback, void *context)
+  {
+    // test and set at once, so only one caller can start a transfer
+    if (_claimed.exchange(true))
+    {
+      return Status::BUSY;
+    }
+
+    DynamicArea area = {
+        .xCrd = 0,
+        .yCrd = 0,
+        .width = OLED_SCREEN_WIDTH,
+        .height = OLED_SCREEN_HEIGHT};
+    Status status = set_dynamic_area(area);
+    if (status != Status::SUCCESS)
+    {
+      _claimed = false;
+      return status;
+    }
+
+    memcpy(_screen_buffer, (pixel_t *)image, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
+    _screen_synced = true;
+    _dirty.clear();
+    if (_retained)
+    {
+      set_buffer_border(area.xCrd, area.yCrd, area.width, area.height);
+    }
+    send_data_async((const uint8_t *)_screen_buffer,
+                    OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t),
+                    callback, context);
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::draw_image_async(const uint8_t *image, TransferCallback callback, void *context)
+  {
+    if (_claimed.exchange(true))
+    {
+      return Status::BUSY;
+    }
+    if (!_area_set)
+    {
+      _claimed = false;
+      return Status::AREA_NOT_SET;
+    }
+
+    // the image is contiguous while the area in the screen buffer may not be,
+    // so the transfer is made straight from the caller's image
+    update_screen_buffer((const pixel_t *)image);
+    if (_retained)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
     }
+    send_data_async(image,
+                    _dynamic_area.width * _dynamic_area.height * sizeof(pixel_t),
+                    callback, context);
 
     return Status::SUCCESS;
   }
 
+  bool SSD1351::is_busy()
+  {
+    return _claimed || _busy;
+  }
+
   Status SSD1351::draw_box(Color color)
   {
-    if (_area_buffer == NULL)
+    wait_transfer();
+    if (!_area_set)
     {
       return Status::AREA_NOT_SET;
     }
 
     uint16_t swappedColor = swap_color(color);
-    for (size_t y = 0; y < _dynamic_area.width * _dynamic_area.height; ++y)
+    for (uint8_t y = 0; y < _dynamic_area.height; y++)
+    {
+      pixel_t *row = _screen_buffer + (y + _dynamic_area.yCrd) * OLED_SCREEN_WIDTH + _dynamic_area.xCrd;
+      for (uint8_t x = 0; x < _dynamic_area.width; x++)
+      {
+        row[x] = swappedColor;
+      }
+    }
+
+    if (_retained)
+    {
+      _dirty.add(_dynamic_area);
+    }
+    else
     {
-      _area_buffer[y] = swappedColor;
+      // the window is already set by set_dynamic_area()
+      send_fill(swappedColor, _dynamic_area.width * _dynamic_area.height);
     }
-    update_screen_buffer(_area_buffer);
-    draw_area_buffer();
 
     return Status::SUCCESS;
   }
@@ -297,44 +771,449 @@ namespace oled
       return status;
     }
 
-    _area_buffer[0] = swap_color(color);
-    update_screen_buffer(_area_buffer);
-    draw_area_buffer();
+    _screen_buffer[y * OLED_SCREEN_WIDTH + x] = swap_color(color);
+    draw_area();
 
     return Status::SUCCESS;
   }
 
-  Status SSD1351::text_box(const char *text)
+  Status SSD1351::draw_pixels(const Point *points, const Color *colors, uint16_t count)
   {
-    if (text == NULL)
+    return plot_pixels(points, colors, 1, count);
+  }
+
+  Status SSD1351::draw_pixels(const Point *points, uint16_t count, Color color)
+  {
+    return plot_pixels(points, &color, 0, count);
+  }
+
+  Status SSD1351::draw_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, Color color)
+  {
+    if (x0 >= OLED_SCREEN_WIDTH || x1 >= OLED_SCREEN_WIDTH ||
+        y0 >= OLED_SCREEN_HEIGHT || y1 >= OLED_SCREEN_HEIGHT)
     {
-      return Status::INVALID_TEXT;
+      return Status::COORD_ERROR;
     }
 
-    return draw_text(text);
+    wait_transfer();
+    plot_line(x0, y0, x1, y1, swap_color(color));
+    send_touched();
+
+    return Status::SUCCESS;
   }
 
-  Status SSD1351::label(const char *text, uint8_t x, uint8_t y)
+  Status SSD1351::draw_box_stroke(Color color, uint8_t stroke)
   {
-    if (text == NULL)
+    wait_transfer();
+    if (!_area_set)
     {
-      return Status::INVALID_TEXT;
+      return Status::AREA_NOT_SET;
     }
 
-    DynamicArea txtArea = {
-        .xCrd = x,
-        .yCrd = y,
-        .width = get_line_width(text),
-        .height = (uint8_t)selectedFont_height};
-    Status status = set_dynamic_area(txtArea);
-    if (status != Status::SUCCESS)
+    if (stroke == 0)
+    {
+      return Status::SUCCESS;
+    }
+
+    // a stroke wider than half the box fills it
+    uint8_t x0 = _dynamic_area.xCrd;
+    uint8_t y0 = _dynamic_area.yCrd;
+    uint8_t x1 = x0 + _dynamic_area.width - 1;
+    uint8_t y1 = y0 + _dynamic_area.height - 1;
+    pixel_t swappedColor = swap_color(color);
+    for (uint8_t y = y0; y <= y1; y++)
+    {
+      if (y - y0 < stroke || y1 - y < stroke)
+      {
+        plot_span(x0, x1, y, swappedColor);
+      }
+      else if (2 * stroke < _dynamic_area.width)
+      {
+        plot_span(x0, x0 + stroke - 1, y, swappedColor);
+        plot_span(x1 - stroke + 1, x1, y, swappedColor);
+      }
+      else
+      {
+        plot_span(x0, x1, y, swappedColor);
+      }
+    }
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::draw_circle(uint8_t xc, uint8_t yc, uint8_t radius, Color color)
+  {
+    if (xc < radius || yc < radius ||
+        xc + radius >= OLED_SCREEN_WIDTH || yc + radius >= OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    // midpoint circle, one octant mirrored eight times
+    wait_transfer();
+    pixel_t swappedColor = swap_color(color);
+    int x = radius;
+    int y = 0;
+    int err = 1 - x;
+    while (x >= y)
+    {
+      plot(xc + x, yc + y, swappedColor);
+      plot(xc - x, yc + y, swappedColor);
+      plot(xc + x, yc - y, swappedColor);
+      plot(xc - x, yc - y, swappedColor);
+      plot(xc + y, yc + x, swappedColor);
+      plot(xc - y, yc + x, swappedColor);
+      plot(xc + y, yc - x, swappedColor);
+      plot(xc - y, yc - x, swappedColor);
+
+      y++;
+      if (err < 0)
+      {
+        err += 2 * y + 1;
+      }
+      else
+      {
+        x--;
+        err += 2 * (y - x) + 1;
+      }
+    }
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::fill_circle(uint8_t xc, uint8_t yc, uint8_t radius, Color color)
+  {
+    if (xc < radius || yc < radius ||
+        xc + radius >= OLED_SCREEN_WIDTH || yc + radius >= OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    // same walk as draw_circle, with spans between the mirrored points
+    wait_transfer();
+    pixel_t swappedColor = swap_color(color);
+    int x = radius;
+    int y = 0;
+    int err = 1 - x;
+    while (x >= y)
+    {
+      plot_span(xc - x, xc + x, yc + y, swappedColor);
+      plot_span(xc - x, xc + x, yc - y, swappedColor);
+      plot_span(xc - y, xc + y, yc + x, swappedColor);
+      plot_span(xc - y, xc + y, yc - x, swappedColor);
+
+      y++;
+      if (err < 0)
+      {
+        err += 2 * y + 1;
+      }
+      else
+      {
+        x--;
+        err += 2 * (y - x) + 1;
+      }
+    }
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::draw_triangle(Point a, Point b, Point c, Color color)
+  {
+    if (a.x >= OLED_SCREEN_WIDTH || b.x >= OLED_SCREEN_WIDTH || c.x >= OLED_SCREEN_WIDTH ||
+        a.y >= OLED_SCREEN_HEIGHT || b.y >= OLED_SCREEN_HEIGHT || c.y >= OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    wait_transfer();
+    pixel_t swappedColor = swap_color(color);
+    plot_line(a.x, a.y, b.x, b.y, swappedColor);
+    plot_line(b.x, b.y, c.x, c.y, swappedColor);
+    plot_line(c.x, c.y, a.x, a.y, swappedColor);
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::fill_triangle(Point a, Point b, Point c, Color color)
+  {
+    if (a.x >= OLED_SCREEN_WIDTH || b.x >= OLED_SCREEN_WIDTH || c.x >= OLED_SCREEN_WIDTH ||
+        a.y >= OLED_SCREEN_HEIGHT || b.y >= OLED_SCREEN_HEIGHT || c.y >= OLED_SCREEN_HEIGHT)
+    {
+      return Status::COORD_ERROR;
+    }
+
+    // sort the vertices by row: a on top, c at the bottom
+    Point tmp;
+    if (a.y > b.y)
+    {
+      tmp = a, a = b, b = tmp;
+    }
+    if (b.y > c.y)
+    {
+      tmp = b, b = c, c = tmp;
+    }
+    if (a.y > b.y)
+    {
+      tmp = a, a = b, b = tmp;
+    }
+
+    // scanline fill: each row spans between the long edge a-c and
+    // one of the short edges, a-b above b and b-c below it; the edges
+    // are drawn too, so rounding never leaves them uncovered
+    wait_transfer();
+    pixel_t swappedColor = swap_color(color);
+    for (int y = a.y; y <= c.y; y++)
+    {
+      int xLong = a.x;
+      if (c.y != a.y)
+      {
+        xLong = a.x + ((int)c.x - a.x) * (y - a.y) / (c.y - a.y);
+      }
+
+      int xShort;
+      if (y < b.y)
+      {
+        xShort = a.x + ((int)b.x - a.x) * (y - a.y) / (b.y - a.y);
+      }
+      else if (c.y != b.y)
+      {
+        xShort = b.x + ((int)c.x - b.x) * (y - b.y) / (c.y - b.y);
+      }
+      else
+      {
+        xShort = b.x;
+      }
+
+      plot_span(xLong < xShort ? xLong : xShort, xLong < xShort ? xShort : xLong, y, swappedColor);
+    }
+    plot_line(a.x, a.y, b.x, b.y, swappedColor);
+    plot_line(b.x, b.y, c.x, c.y, swappedColor);
+    plot_line(c.x, c.y, a.x, a.y, swappedColor);
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::text_box(const char *text)
+  {
+    const TextLayout *layout;
+    Status status = cached_layout(text, &layout);
+    if (status != Status::SUCCESS)
     {
       return status;
     }
 
-    status = draw_text(text);
+    return draw_layout(layout);
+  }
 
-    return status;
+  Status SSD1351::text_box(const TextLayout *layout)
+  {
+    if (layout == NULL || layout->text == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    // a layout measured with another font is no longer valid
+    if (layout->font != _text_properties.font)
+    {
+      return text_box(layout->text);
+    }
+
+    return draw_layout(layout);
+  }
+
+  Status SSD1351::label(const char *text, uint8_t x, uint8_t y)
+  {
+    const TextLayout *layout;
+    Status status = cached_layout(text, &layout);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+    if (layout->line[0].width > OLED_SCREEN_WIDTH)
+    {
+      return Status::TEXT_OVERFLOW;
+    }
+
+    DynamicArea txtArea = {
+        .xCrd = x,
+        .yCrd = y,
+        .width = (uint8_t)layout->line[0].width,
+        .height = (uint8_t)selectedFont_height};
+    status = set_dynamic_area(txtArea);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+
+    return draw_layout(layout);
+  }
+
+  Status SSD1351::create_label(Label *label, DynamicArea area, Color background)
+  {
+    if (label == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    Status status = set_dynamic_area(area);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+
+    label->area = area;
+    label->background = background;
+    label->font = _text_properties.font;
+    label->fontColor = _text_properties.fontColor;
+    label->length = 0;
+    uint8_t xOff;
+    compute_alignment(0, 0, 1, &xOff, &label->yOffset);
+
+    return draw_box(background);
+  }
+
+  Status SSD1351::update_label(Label *label, const char *text)
+  {
+    wait_transfer();
+    if (label == NULL || text == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    const TextLayout *layout;
+    Status status = cached_layout(text, &layout);
+    if (status != Status::SUCCESS)
+    {
+      return status;
+    }
+    size_t length = layout->line[0].length;
+    if (layout->lines > 1 || length > OLED_LABEL_MAX_CHARS ||
+        layout->width > label->area.width ||
+        selectedFont_height > label->area.height)
+    {
+      return Status::TEXT_OVERFLOW;
+    }
+
+    // the window is restored at the end, no need to send it now
+    _dynamic_area = label->area;
+    _area_set = true;
+
+    // 1. Lay out the new text
+    uint8_t xOffset[OLED_LABEL_MAX_CHARS];
+    uint8_t xOff, yOff;
+    compute_alignment(layout->width, 0, 1, &xOff, &yOff);
+    for (size_t i = 0; i < length; i++)
+    {
+      xOffset[i] = xOff + layout->glyphX[i];
+    }
+
+    // 2. Mark the columns of the characters that changed or moved,
+    // before and after
+    uint32_t cols[(OLED_SCREEN_WIDTH + 31) / 32] = {0};
+    bool full = label->font != _text_properties.font ||
+                label->fontColor != _text_properties.fontColor ||
+                label->yOffset != yOff;
+    for (size_t i = 0; !full && i < OLED_LABEL_MAX_CHARS; i++)
+    {
+      bool inOld = i < label->length;
+      bool inNew = i < length;
+      if (inOld && inNew && label->text[i] == text[i] && label->xOffset[i] == xOffset[i])
+      {
+        continue;
+      }
+
+      uint8_t cells[2][2];
+      uint8_t cellCount = 0;
+      if (inOld)
+      {
+        cells[cellCount][0] = label->xOffset[i];
+        cells[cellCount++][1] = label->xOffset[i] + get_char_width(label->text[i]);
+      }
+      if (inNew)
+      {
+        cells[cellCount][0] = xOffset[i];
+        cells[cellCount++][1] = xOffset[i] + get_char_width(text[i]);
+      }
+      for (uint8_t c = 0; c < cellCount; c++)
+      {
+        for (uint8_t x = cells[c][0]; x < cells[c][1] && x < label->area.width; x++)
+        {
+          cols[x / 32] |= 1u << (x % 32);
+        }
+      }
+    }
+    if (full)
+    {
+      for (uint8_t x = 0; x < label->area.width; x++)
+      {
+        cols[x / 32] |= 1u << (x % 32);
+      }
+    }
+
+    // 3. Repaint each run of marked columns and send it as a window
+    pixel_t *areaOrigin = _screen_buffer + label->area.yCrd * OLED_SCREEN_WIDTH + label->area.xCrd;
+    pixel_t background = swap_color(label->background);
+    bool sent = false;
+    uint8_t x = 0;
+    while (x < label->area.width)
+    {
+      if (!(cols[x / 32] & (1u << (x % 32))))
+      {
+        x++;
+        continue;
+      }
+      uint8_t first = x;
+      while (x < label->area.width && (cols[x / 32] & (1u << (x % 32))))
+      {
+        x++;
+      }
+
+      for (uint8_t y = 0; y < label->area.height; y++)
+      {
+        for (uint8_t c = first; c < x; c++)
+        {
+          areaOrigin[y * OLED_SCREEN_WIDTH + c] = background;
+        }
+      }
+      for (size_t i = 0; i < length; i++)
+      {
+        if (xOffset[i] >= first && xOffset[i] < x)
+        {
+          uint8_t charX = xOffset[i];
+          uint8_t charY = yOff;
+          write_char_to_buffer(areaOrigin, text[i], &charX, &charY);
+        }
+      }
+
+      DynamicArea run = {
+          .xCrd = (uint8_t)(label->area.xCrd + first),
+          .yCrd = label->area.yCrd,
+          .width = (uint8_t)(x - first),
+          .height = label->area.height};
+      send_window(run);
+      sent = true;
+    }
+
+    // restore the window of the dynamic area
+    if (sent && !_retained)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
+
+    // 4. Remember what is on screen
+    label->font = _text_properties.font;
+    label->fontColor = _text_properties.fontColor;
+    label->yOffset = yOff;
+    label->length = (uint8_t)length;
+    memcpy(label->text, text, length);
+    memcpy(label->xOffset, xOffset, length);
+
+    return Status::SUCCESS;
   }
 
   void SSD1351::get_text_properties(TextProperties *prop)
@@ -345,6 +1224,170 @@ namespace oled
     prop->bgImage = _text_properties.bgImage;
   }
 
+  void SSD1351::set_scene_background(const uint8_t *image)
+  {
+    DynamicArea screen = {
+        .xCrd = 0,
+        .yCrd = 0,
+        .width = OLED_SCREEN_WIDTH,
+        .height = OLED_SCREEN_HEIGHT};
+    _scene_image = (const pixel_t *)image;
+    _scene_dirty.add(screen);
+  }
+
+  void SSD1351::set_scene_background(Color color)
+  {
+    _scene_color = swap_color(color);
+    set_scene_background((const uint8_t *)NULL);
+  }
+
+  Status SSD1351::add_layer(Layer *layer)
+  {
+    for (uint8_t i = 0; i < _layer_count; i++)
+    {
+      if (_layers[i] == layer)
+      {
+        return Status::COORD_ERROR;
+      }
+    }
+    if (_layer_count == OLED_LAYERS_MAX)
+    {
+      return Status::SCENE_FULL;
+    }
+    if (layer->text != NULL &&
+        !(layer->x >= 0 && layer->y >= 0 &&
+          layer->x + layer->width <= OLED_SCREEN_WIDTH &&
+          layer->y + layer->height <= OLED_SCREEN_HEIGHT))
+    {
+      return Status::COORD_ERROR;
+    }
+
+    _layers[_layer_count++] = layer;
+    invalidate_layer(layer);
+
+    return Status::SUCCESS;
+  }
+
+  Status SSD1351::remove_layer(Layer *layer)
+  {
+    for (uint8_t i = 0; i < _layer_count; i++)
+    {
+      if (_layers[i] == layer)
+      {
+        invalidate_layer(layer);
+        for (uint8_t j = i + 1; j < _layer_count; j++)
+        {
+          _layers[j - 1] = _layers[j];
+        }
+        _layer_count--;
+        return Status::SUCCESS;
+      }
+    }
+
+    return Status::COORD_ERROR;
+  }
+
+  Status SSD1351::move_layer(Layer *layer, int16_t x, int16_t y)
+  {
+    if (layer->text != NULL &&
+        !(x >= 0 && y >= 0 &&
+          x + layer->width <= OLED_SCREEN_WIDTH &&
+          y + layer->height <= OLED_SCREEN_HEIGHT))
+    {
+      return Status::COORD_ERROR;
+    }
+
+    // the old area shows what was under the layer, the new one the layer;
+    // the dirty region merges them when they overlap
+    invalidate_layer(layer);
+    layer->x = x;
+    layer->y = y;
+    invalidate_layer(layer);
+
+    return Status::SUCCESS;
+  }
+
+  void SSD1351::invalidate_layer(Layer *layer)
+  {
+    DynamicArea area;
+    if (get_layer_area(layer, &area))
+    {
+      _scene_dirty.add(area);
+    }
+  }
+
+  Status SSD1351::compose()
+  {
+    if (_scene_dirty.count() == 0)
+    {
+      return Status::SUCCESS;
+    }
+
+    wait_transfer();
+
+    Status status = Status::SUCCESS;
+    bool wholeScreen = false;
+    for (uint8_t i = 0; i < _scene_dirty.count(); i++)
+    {
+      DynamicArea area = _scene_dirty.get(i);
+
+      // text is blended into what is under it, so a text crossing the
+      // area is composed again in full; growing the area may make it
+      // cross another text
+      bool grown = true;
+      while (grown)
+      {
+        grown = false;
+        for (uint8_t l = 0; l < _layer_count; l++)
+        {
+          DynamicArea text;
+          if (!_layers[l]->visible || _layers[l]->text == NULL ||
+              !get_layer_area(_layers[l], &text) ||
+              text.xCrd >= area.xCrd + area.width || area.xCrd >= text.xCrd + text.width ||
+              text.yCrd >= area.yCrd + area.height || area.yCrd >= text.yCrd + text.height)
+          {
+            continue;
+          }
+
+          uint8_t x0 = area.xCrd < text.xCrd ? area.xCrd : text.xCrd;
+          uint8_t y0 = area.yCrd < text.yCrd ? area.yCrd : text.yCrd;
+          uint8_t x1 = area.xCrd + area.width > text.xCrd + text.width ? area.xCrd + area.width : text.xCrd + text.width;
+          uint8_t y1 = area.yCrd + area.height > text.yCrd + text.height ? area.yCrd + area.height : text.yCrd + text.height;
+          if (x0 != area.xCrd || y0 != area.yCrd || x1 - x0 != area.width || y1 - y0 != area.height)
+          {
+            area.xCrd = x0;
+            area.yCrd = y0;
+            area.width = x1 - x0;
+            area.height = y1 - y0;
+            grown = true;
+          }
+        }
+      }
+
+      if (compose_area(area) != Status::SUCCESS)
+      {
+        status = Status::TEXT_OVERFLOW;
+      }
+      send_window(area);
+      wholeScreen |= area.width == OLED_SCREEN_WIDTH && area.height == OLED_SCREEN_HEIGHT;
+    }
+    _scene_dirty.clear();
+
+    // the screen buffer only matches the OLED everywhere once the whole
+    // scene is composed; sending a part keeps it as it was
+    if (wholeScreen && status == Status::SUCCESS)
+    {
+      _screen_synced = true;
+    }
+
+    if (!_retained)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
+
+    return status;
+  }
+
   void SSD1351::set_text_properties(TextProperties *prop)
   {
     _text_properties.font = prop->font;
@@ -355,84 +1398,765 @@ namespace oled
     selectedFont_firstChar = prop->font[2] | ((uint16_t)prop->font[3] << 8);
     selectedFont_lastChar = prop->font[4] | ((uint16_t)prop->font[5] << 8);
     selectedFont_height = prop->font[6];
+
+#if OLED_SPAN_FONTS
+    // use the span-encoded version of the font if it's compiled in
+    _span_font = NULL;
+    for (uint8_t i = 0; i < SpanFontsCount; i++)
+    {
+      if (SpanFonts[i]->source == prop->font)
+      {
+        _span_font = SpanFonts[i];
+        break;
+      }
+    }
+#endif
+
+    // and the alpha version, used when anti-aliasing is enabled
+    _alpha_font = NULL;
+    for (uint8_t i = 0; i < AlphaFontsCount; i++)
+    {
+      if (AlphaFonts[i]->source == prop->font)
+      {
+        _alpha_font = AlphaFonts[i];
+        break;
+      }
+    }
+  }
+
+  void SSD1351::set_glyph_cache_size(uint8_t glyphs)
+  {
+    _glyph_cache.resize(glyphs);
+  }
+
+  void SSD1351::set_text_antialiasing(bool enable)
+  {
+    _antialias = enable;
   }
 
   /////////////////////
   // private methods //
   /////////////////////
 
-  void SSD1351::send_cmd(Command command)
+  void SSD1351::send_cmds(const CommandList &commands)
+  {
+    wait_transfer();
+#if OLED_RENDERER
+    wait_display();
+#endif
+    _transport->select();
+    commands.write(_transport);
+    _transport->deselect();
+  }
+
+  void SSD1351::start_ram_write()
+  {
+    const uint8_t writeRam = OLED_CMD_WRITERAM;
+
+    // the command and the pixels that follow share the chip select
+    wait_transfer();
+#if OLED_RENDERER
+    wait_display();
+#endif
+    _transport->set_data_mode(false);
+    _transport->select();
+    _transport->write(&writeRam, 1);
+    _transport->set_data_mode(true);
+  }
+
+  void SSD1351::send_data(const uint8_t *dataToSend, uint32_t dataSize)
+  {
+    start_ram_write();
+    write_ram(dataToSend, dataSize);
+    _transport->deselect();
+  }
+
+  void SSD1351::write_ram(const uint8_t *data, uint32_t size)
+  {
+    while (_window_split && size > 0)
+    {
+      if (_window_left == 0)
+      {
+        next_window_part();
+      }
+      uint32_t count = size < _window_left ? size : _window_left;
+      _transport->write(data, count);
+      data += count;
+      size -= count;
+      _window_left -= count;
+    }
+    if (size > 0)
+    {
+      _transport->write(data, size);
+    }
+  }
+
+  void SSD1351::send_fill(pixel_t swappedColor, uint32_t pixels)
+  {
+    // a solid fill needs no buffer, stream the same burst over and over
+    pixel_t burst[OLED_FILL_BURST_SIZE];
+    uint32_t burstPixels = pixels < OLED_FILL_BURST_SIZE ? pixels : OLED_FILL_BURST_SIZE;
+    for (uint32_t i = 0; i < burstPixels; i++)
+    {
+      burst[i] = swappedColor;
+    }
+
+    start_ram_write();
+    while (pixels > 0)
+    {
+      uint32_t count = pixels < OLED_FILL_BURST_SIZE ? pixels : OLED_FILL_BURST_SIZE;
+      write_ram((const uint8_t *)burst, count * sizeof(pixel_t));
+      pixels -= count;
+    }
+    _transport->deselect();
+  }
+
+  void SSD1351::send_data_async(const uint8_t *dataToSend, uint32_t dataSize,
+                                TransferCallback callback, void *context)
+  {
+    start_ram_write();
+
+    // a transfer can't switch to the other part of a split window, so
+    // everything before the last switch is sent right away
+    while (_window_split && dataSize > _window_left)
+    {
+      uint32_t count = _window_left;
+      _transport->write(dataToSend, count);
+      dataToSend += count;
+      dataSize -= count;
+      next_window_part();
+    }
+    if (_window_split)
+    {
+      _window_left -= dataSize;
+    }
+
+    _user_callback = callback;
+    _user_context = context;
+    _busy = true;
+
+    // CS and DC stay asserted until the transfer completes
+    _transport->write_async(dataToSend, dataSize, &SSD1351::on_transfer_complete, this);
+  }
+
+  void SSD1351::wait_transfer()
+  {
+    // a set left over from an earlier transfer only costs another check
+    while (_busy)
+    {
+      _transfer_done.wait();
+    }
+  }
+
+  void SSD1351::on_batch_complete(void *context)
+  {
+    SSD1351 *self = (SSD1351 *)context;
+
+    // the chip select stays asserted for the next batch
+    self->_busy = false;
+    self->_transfer_done.set();
+  }
+
+  void SSD1351::on_transfer_complete(void *context)
+  {
+    SSD1351 *self = (SSD1351 *)context;
+    TransferCallback callback = self->_user_callback;
+    void *userContext = self->_user_context;
+
+    self->_transport->deselect();
+    self->_busy = false;
+    self->_claimed = false;
+    self->_transfer_done.set();
+
+    if (callback != NULL)
+    {
+      callback(userContext);
+    }
+  }
+
+#if OLED_RENDERER
+  void SSD1351::wait_display()
+  {
+    // a set left over from an earlier frame only costs another check
+    while (_presenting)
+    {
+      _frame_sent.wait();
+    }
+  }
+
+  void SSD1351::on_display_work(void *context)
+  {
+    ((SSD1351 *)context)->send_frame();
+  }
+
+  void SSD1351::send_frame()
+  {
+    // each rectangle takes a single chip select: window, write RAM, pixels
+    for (uint8_t i = 0; i < _frame_count; i++)
+    {
+      DynamicArea area = _frame_rects[i];
+      CommandList commands;
+      add_border(&commands, area, _frame_row_base);
+      commands.add({OLED_CMD_WRITERAM, CMD_BYTE});
+      track_border(area, _frame_row_base);
+
+      _transport->select();
+      commands.write(_transport);
+      _transport->set_data_mode(true);
+      write_rows(_front_buffer, area);
+      _transport->deselect();
+    }
+
+    // hand the front buffer back to the application
+    _presenting = false;
+    _frame_sent.set();
+  }
+#endif
+
+  uint8_t SSD1351::border_rows(DynamicArea area, uint8_t rowBase, uint8_t part)
+  {
+    // a window that crosses the last RAM row goes on from row 0
+    uint8_t row = (area.yCrd + OLED_ROW_OFFSET + rowBase) % OLED_RAM_ROWS;
+    uint8_t rows = row + area.height > OLED_RAM_ROWS ? OLED_RAM_ROWS - row : area.height;
+    return part == 0 ? rows : area.height - rows;
+  }
+
+  void SSD1351::add_border(CommandList *commands, DynamicArea area, uint8_t rowBase, uint8_t part)
+  {
+    uint8_t row = part == 0 ? (area.yCrd + OLED_ROW_OFFSET + rowBase) % OLED_RAM_ROWS : 0;
+    uint8_t rows = border_rows(area, rowBase, part);
+    commands->add({OLED_CMD_SET_COLUMN, CMD_BYTE})
+        .add({(uint32_t)area.xCrd + OLED_COLUMN_OFFSET, DATA_BYTE})
+        .add({(uint32_t)area.xCrd + OLED_COLUMN_OFFSET + area.width - 1, DATA_BYTE})
+        .add({OLED_CMD_SET_ROW, CMD_BYTE})
+        .add({(uint32_t)row, DATA_BYTE})
+        .add({(uint32_t)row + rows - 1, DATA_BYTE});
+  }
+
+  void SSD1351::track_border(DynamicArea area, uint8_t rowBase)
+  {
+    _window = area;
+    _window_base = rowBase;
+    _window_part = 0;
+    _window_split = border_rows(area, rowBase, 1) != 0;
+    _window_left = (uint32_t)border_rows(area, rowBase, 0) * area.width * sizeof(pixel_t);
+  }
+
+  void SSD1351::next_window_part()
+  {
+    // the OLED wraps to the first row of a window, a split window wraps
+    // to the other part; the pixels go on in the same chip select
+    _window_part ^= 1;
+    _window_left = (uint32_t)border_rows(_window, _window_base, _window_part) * _window.width * sizeof(pixel_t);
+
+    CommandList commands;
+    add_border(&commands, _window, _window_base, _window_part);
+    commands.add({OLED_CMD_WRITERAM, CMD_BYTE});
+    commands.write(_transport);
+    _transport->set_data_mode(true);
+  }
+
+  void SSD1351::set_buffer_border(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+  {
+    DynamicArea area = {
+        .xCrd = x,
+        .yCrd = y,
+        .width = w,
+        .height = h};
+    CommandList commands;
+    add_border(&commands, area, _row_base);
+    send_cmds(commands);
+    track_border(area, _row_base);
+  }
+
+  void SSD1351::set_start_line(uint8_t row)
+  {
+    send_cmds(CommandList()
+                  .add({OLED_CMD_STARTLINE, CMD_BYTE})
+                  .add({(uint32_t)(row % OLED_RAM_ROWS), DATA_BYTE}));
+  }
+
+  void SSD1351::update_screen_buffer(const pixel_t *image)
+  {
+    for (size_t y = 0; y < _dynamic_area.height; y++)
+    {
+      memcpy(_screen_buffer + (y + _dynamic_area.yCrd) * OLED_SCREEN_WIDTH + _dynamic_area.xCrd,
+             image + y * _dynamic_area.width,
+             _dynamic_area.width * sizeof(pixel_t));
+    }
+  }
+
+  void SSD1351::transpose_screen_buffer()
+  {
+    // transitions always use the whole screen, which is square,
+    // so the buffer can be transposed in place
+    for (uint8_t i = 0; i < OLED_SCREEN_HEIGHT; i++)
+    {
+      for (uint8_t j = i + 1; j < OLED_SCREEN_WIDTH; j++)
+      {
+        pixel_t tmp = _screen_buffer[i * OLED_SCREEN_WIDTH + j];
+        _screen_buffer[i * OLED_SCREEN_WIDTH + j] = _screen_buffer[j * OLED_SCREEN_WIDTH + i];
+        _screen_buffer[j * OLED_SCREEN_WIDTH + i] = tmp;
+      }
+    }
+  }
+
+  void SSD1351::draw_screen_buffer()
+  {
+    if (_retained)
+    {
+      DynamicArea screen = {
+          .xCrd = 0,
+          .yCrd = 0,
+          .width = OLED_SCREEN_WIDTH,
+          .height = OLED_SCREEN_HEIGHT};
+      _dirty.add(screen);
+      return;
+    }
+
+    send_data((const uint8_t *)_screen_buffer, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
+  }
+
+  void SSD1351::draw_area()
+  {
+    if (_retained)
+    {
+      _dirty.add(_dynamic_area);
+      return;
+    }
+
+    // the window is already set by set_dynamic_area()
+    send_screen_rows(_dynamic_area);
+  }
+
+  void SSD1351::draw_screen_window(DynamicArea area)
+  {
+    set_buffer_border(area.xCrd, area.yCrd, area.width, area.height);
+    send_screen_rows(area);
+  }
+
+  void SSD1351::send_screen_rows(DynamicArea area)
+  {
+    start_ram_write();
+    write_rows(_screen_buffer, area);
+    _transport->deselect();
+  }
+
+  void SSD1351::write_rows(const pixel_t *buffer, DynamicArea area)
+  {
+    if (area.width == OLED_SCREEN_WIDTH)
+    {
+      // full rows are contiguous in the buffer
+      write_ram((const uint8_t *)(buffer + area.yCrd * OLED_SCREEN_WIDTH),
+                area.width * area.height * sizeof(pixel_t));
+    }
+    else
+    {
+      for (uint8_t y = area.yCrd; y < area.yCrd + area.height; y++)
+      {
+        write_ram((const uint8_t *)(buffer + y * OLED_SCREEN_WIDTH + area.xCrd),
+                  area.width * sizeof(pixel_t));
+      }
+    }
+  }
+
+  void SSD1351::decode_area(const CompressedImage *image)
+  {
+    // each row is expanded in place in the screen buffer and sent from
+    // there, so the image never needs a copy of its own
+    ImageDecoder decoder;
+    decoder.start(image);
+
+    if (!_retained)
+    {
+      // the window is already set by set_dynamic_area()
+      start_ram_write();
+    }
+    for (uint8_t y = _dynamic_area.yCrd; y < _dynamic_area.yCrd + _dynamic_area.height; y++)
+    {
+      pixel_t *row = _screen_buffer + y * OLED_SCREEN_WIDTH + _dynamic_area.xCrd;
+      decoder.read(row, _dynamic_area.width);
+      if (!_retained)
+      {
+        write_ram((const uint8_t *)row, _dynamic_area.width * sizeof(pixel_t));
+      }
+    }
+
+    if (_retained)
+    {
+      _dirty.add(_dynamic_area);
+    }
+    else
+    {
+      _transport->deselect();
+    }
+  }
+
+  Status SSD1351::stream_area(ImageSource *source)
+  {
+    uint8_t yEnd = _dynamic_area.yCrd + _dynamic_area.height;
+    if (_retained)
+    {
+      _dirty.add(_dynamic_area);
+      if (!read_rows(source, _dynamic_area.yCrd, _dynamic_area.height))
+      {
+        _screen_synced = false;
+        return Status::READ_ERROR;
+      }
+      return Status::SUCCESS;
+    }
+
+    // the rows land in the screen buffer, which is where they belong
+    // anyway, and are sent from there: while a batch is being sent the
+    // next one is read into the rows below it
+    // Rows narrower than the screen are not contiguous, so they go one by one
+    uint8_t batch = _dynamic_area.width == OLED_SCREEN_WIDTH ? OLED_STREAM_BATCH_ROWS : 1;
+    Status status = Status::SUCCESS;
+
+    // the window is already set by set_dynamic_area()
+    start_ram_write();
+    for (uint8_t y = _dynamic_area.yCrd; y < yEnd; y += batch)
+    {
+      uint8_t rows = yEnd - y < batch ? yEnd - y : batch;
+      if (!read_rows(source, y, rows))
+      {
+        _screen_synced = false;
+        status = Status::READ_ERROR;
+        break;
+      }
+
+      wait_transfer();
+      const uint8_t *batchData = (const uint8_t *)(_screen_buffer + y * OLED_SCREEN_WIDTH + _dynamic_area.xCrd);
+      uint32_t batchSize = rows * _dynamic_area.width * sizeof(pixel_t);
+
+      // a transfer can't switch to the other part of a split window, so
+      // the batch that crosses it is sent right away
+      if (_window_split)
+      {
+        if (batchSize > _window_left)
+        {
+          write_ram(batchData, batchSize);
+          continue;
+        }
+        _window_left -= batchSize;
+      }
+
+      _busy = true;
+      _transport->write_async(batchData, batchSize, &SSD1351::on_batch_complete, this);
+    }
+    wait_transfer();
+    _transport->deselect();
+
+    return status;
+  }
+
+  bool SSD1351::read_rows(ImageSource *source, uint8_t y, uint8_t rows)
+  {
+    // full rows are contiguous, the others are read one by one
+    uint8_t parts = _dynamic_area.width == OLED_SCREEN_WIDTH ? 1 : rows;
+    uint32_t partSize = (uint32_t)_dynamic_area.width * (rows / parts) * sizeof(pixel_t);
+
+    for (uint8_t part = 0; part < parts; part++)
+    {
+      uint8_t *dst = (uint8_t *)(_screen_buffer + (y + part) * OLED_SCREEN_WIDTH + _dynamic_area.xCrd);
+      uint32_t done = 0;
+      while (done < partSize)
+      {
+        uint32_t read = source->read(dst + done, partSize - done);
+        if (read == 0)
+        {
+          return false;
+        }
+        done += read;
+      }
+    }
+
+    return true;
+  }
+
+  void SSD1351::send_window(DynamicArea area)
+  {
+    if (_retained)
+    {
+      _dirty.add(area);
+    }
+    else
+    {
+      draw_screen_window(area);
+    }
+  }
+
+  Status SSD1351::plot_pixels(const Point *points, const Color *colors, uint8_t colorStep, uint16_t count)
+  {
+    if (points == NULL || colors == NULL)
+    {
+      return Status::COORD_ERROR;
+    }
+    for (uint16_t i = 0; i < count; i++)
+    {
+      if (points[i].x >= OLED_SCREEN_WIDTH || points[i].y >= OLED_SCREEN_HEIGHT)
+      {
+        return Status::COORD_ERROR;
+      }
+    }
+
+    wait_transfer();
+    for (uint16_t i = 0; i < count; i++)
+    {
+      plot(points[i].x, points[i].y, swap_color(colors[i * colorStep]));
+    }
+    send_touched();
+
+    return Status::SUCCESS;
+  }
+
+  void SSD1351::plot(uint8_t x, uint8_t y, pixel_t swappedColor)
+  {
+    _screen_buffer[y * OLED_SCREEN_WIDTH + x] = swappedColor;
+    _touched[y][x / 32] |= 1u << (x % 32);
+  }
+
+  void SSD1351::plot_span(uint8_t x0, uint8_t x1, uint8_t y, pixel_t swappedColor)
+  {
+    pixel_t *row = _screen_buffer + y * OLED_SCREEN_WIDTH;
+    for (uint8_t x = x0; x <= x1; x++)
+    {
+      row[x] = swappedColor;
+    }
+
+    // mark the span a word at a time
+    for (uint8_t w = x0 / 32; w <= x1 / 32; w++)
+    {
+      uint32_t mask = 0xFFFFFFFF;
+      if (w == x0 / 32)
+      {
+        mask &= 0xFFFFFFFF << (x0 % 32);
+      }
+      if (w == x1 / 32)
+      {
+        mask &= 0xFFFFFFFF >> (31 - x1 % 32);
+      }
+      _touched[y][w] |= mask;
+    }
+  }
+
+  void SSD1351::plot_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, pixel_t swappedColor)
   {
-    uint8_t txBuf[4];
+    if (y0 == y1)
+    {
+      plot_span(x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, y0, swappedColor);
+      return;
+    }
 
-    memcpy(txBuf, (void *)&command.cmd, 1);
-    _dc = command.type ? 0 : 1;
-    _cs = 0;
-    _spi.write(*txBuf);
-    _cs = 1;
+    // Bresenham, with the error term kept for both axes
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int x = x0;
+    int y = y0;
+    while (true)
+    {
+      plot(x, y, swappedColor);
+      if (x == x1 && y == y1)
+      {
+        break;
+      }
+      int e2 = 2 * err;
+      if (e2 >= dy)
+      {
+        err += dy;
+        x += sx;
+      }
+      if (e2 <= dx)
+      {
+        err += dx;
+        y += sy;
+      }
+    }
   }
 
-  void SSD1351::send_data(const uint8_t *dataToSend, uint32_t dataSize)
+  void SSD1351::send_touched()
   {
-    send_cmd({OLED_CMD_WRITERAM, CMD_BYTE});
+    // Split each row into runs, joining pixels closer than the gap, then
+    // grow windows out of the runs: two windows are joined into their
+    // bounding box when the pixels it adds cost less than a window setup
+    DynamicArea windows[OLED_PIXEL_WINDOWS_MAX];
+    uint8_t count = 0;
+    bool sent = false;
+    for (uint8_t y = 0; y < OLED_SCREEN_HEIGHT; y++)
+    {
+      // a window too far above this row can't be joined any more
+      for (uint8_t j = 0; j < count;)
+      {
+        if (y - (windows[j].yCrd + windows[j].height) > OLED_WINDOW_SETUP_PIXELS)
+        {
+          send_window(windows[j]);
+          sent = true;
+          windows[j] = windows[--count];
+        }
+        else
+        {
+          j++;
+        }
+      }
+
+      uint8_t x = 0;
+      while (x < OLED_SCREEN_WIDTH)
+      {
+        // skip to the next touched pixel of the row
+        const uint32_t *cols = _touched[y];
+        uint32_t bits = cols[x / 32] >> (x % 32);
+        if (bits == 0)
+        {
+          x = (x / 32 + 1) * 32;
+          continue;
+        }
+        x += __builtin_ctz(bits);
+
+        uint8_t first = x;
+        uint8_t last = x;
+        for (x = first + 1; x < OLED_SCREEN_WIDTH && x - last <= OLED_PIXEL_RUN_GAP + 1; x++)
+        {
+          if (cols[x / 32] & (1u << (x % 32)))
+          {
+            last = x;
+          }
+        }
 
-    /* sending data -> set DC pin */
-    _dc = 1;
-    _cs = 0;
+        // join the run with the cheapest window, again and again, as the
+        // grown window may reach another one
+        DynamicArea run = {
+            .xCrd = first,
+            .yCrd = y,
+            .width = (uint8_t)(last - first + 1),
+            .height = 1};
+        while (true)
+        {
+          int16_t best = -1;
+          int32_t bestExtra = OLED_WINDOW_SETUP_PIXELS + 1;
+          DynamicArea bestBox = run;
+          for (uint8_t j = 0; j < count; j++)
+          {
+            DynamicArea box = bounding_box(windows[j], run);
+            int32_t extra = area_pixels(box) - area_pixels(windows[j]) - area_pixels(run);
+            if (extra < bestExtra)
+            {
+              best = j;
+              bestExtra = extra;
+              bestBox = box;
+            }
+          }
+          if (best < 0)
+          {
+            break;
+          }
+          run = bestBox;
+          windows[best] = windows[--count];
+        }
 
-    const uint8_t *bufPtr = dataToSend;
-    for (uint32_t i = 0; i < dataSize; i++)
+        // without room, the window that ends the highest goes first
+        if (count == OLED_PIXEL_WINDOWS_MAX)
+        {
+          uint8_t top = 0;
+          for (uint8_t j = 1; j < count; j++)
+          {
+            if (windows[j].yCrd + windows[j].height < windows[top].yCrd + windows[top].height)
+            {
+              top = j;
+            }
+          }
+          send_window(windows[top]);
+          sent = true;
+          windows[top] = windows[--count];
+        }
+        windows[count++] = run;
+      }
+      memset(_touched[y], 0, sizeof(_touched[y]));
+    }
+    for (uint8_t j = 0; j < count; j++)
     {
-      _spi.write(*bufPtr);
-      bufPtr += 1;
+      send_window(windows[j]);
+      sent = true;
     }
 
-    _cs = 1;
+    // restore the window of the dynamic area
+    if (sent && !_retained)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
   }
 
-  void SSD1351::set_buffer_border(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+  void SSD1351::draw_screen_diff(const uint8_t *image)
   {
-    send_cmd({OLED_CMD_SET_COLUMN, CMD_BYTE});
-    send_cmd({(uint32_t)x + OLED_COLUMN_OFFSET, DATA_BYTE});
-    send_cmd({(uint32_t)x + OLED_COLUMN_OFFSET + w - 1, DATA_BYTE});
-    send_cmd({OLED_CMD_SET_ROW, CMD_BYTE});
-    send_cmd({(uint32_t)y + OLED_ROW_OFFSET, DATA_BYTE});
-    send_cmd({(uint32_t)y + OLED_ROW_OFFSET + h - 1, DATA_BYTE});
-  }
+    const uint8_t *screen = (const uint8_t *)_screen_buffer;
+    const size_t rowBytes = OLED_SCREEN_WIDTH * sizeof(pixel_t);
+    const size_t tileBytes = OLED_DIFF_TILE_SIZE * sizeof(pixel_t);
+    bool sent = false;
 
-  void SSD1351::update_screen_buffer(pixel_t *image)
-  {
-    for (size_t y = 0; y < _dynamic_area.height; y++)
+    for (uint8_t ty = 0; ty < OLED_SCREEN_HEIGHT; ty += OLED_DIFF_TILE_SIZE)
     {
-      for (size_t x = 0; x < _dynamic_area.width; x++)
+      // 1. Find the changed tiles of this band
+      bool changed[OLED_DIFF_TILE_COLUMNS] = {false};
+      for (uint8_t tx = 0; tx < OLED_DIFF_TILE_COLUMNS; tx++)
       {
-        _screen_buffer[(y + _dynamic_area.yCrd) * OLED_SCREEN_WIDTH + (x + _dynamic_area.xCrd)] = image[y * _dynamic_area.width + x];
+        for (uint8_t y = ty; y < ty + OLED_DIFF_TILE_SIZE; y++)
+        {
+          size_t offset = y * rowBytes + tx * tileBytes;
+          if (tile_row_changed(screen + offset, image + offset))
+          {
+            changed[tx] = true;
+            break;
+          }
+        }
       }
-    }
-  }
 
-  void SSD1351::transpose_screen_buffer()
-  {
-    pixel_t *tmpBuff = (pixel_t *)malloc(_dynamic_area.width * _dynamic_area.height * sizeof(pixel_t));
-    memcpy(tmpBuff, _screen_buffer, _dynamic_area.width * _dynamic_area.height * sizeof(pixel_t));
-    for (uint8_t i = 0; i < _dynamic_area.height; i++)
-    {
-      for (uint8_t j = 0; j < _dynamic_area.width; j++)
+      // 2. Send runs of adjacent changed tiles as a single window
+      uint8_t tx = 0;
+      while (tx < OLED_DIFF_TILE_COLUMNS)
       {
-        _screen_buffer[j * _dynamic_area.height + i] = tmpBuff[i * _dynamic_area.width + j];
+        if (!changed[tx])
+        {
+          tx++;
+          continue;
+        }
+
+        uint8_t first = tx;
+        while (tx < OLED_DIFF_TILE_COLUMNS && changed[tx])
+        {
+          tx++;
+        }
+
+        DynamicArea run = {
+            .xCrd = (uint8_t)(first * OLED_DIFF_TILE_SIZE),
+            .yCrd = ty,
+            .width = (uint8_t)((tx - first) * OLED_DIFF_TILE_SIZE),
+            .height = OLED_DIFF_TILE_SIZE};
+        for (uint8_t y = run.yCrd; y < run.yCrd + run.height; y++)
+        {
+          memcpy(_screen_buffer + y * OLED_SCREEN_WIDTH + run.xCrd,
+                 image + y * rowBytes + run.xCrd * sizeof(pixel_t),
+                 run.width * sizeof(pixel_t));
+        }
+
+        if (_retained)
+        {
+          _dirty.add(run);
+        }
+        else
+        {
+          draw_screen_window(run);
+          sent = true;
+        }
       }
     }
-    free(tmpBuff);
-  }
-
-  void SSD1351::draw_screen_buffer()
-  {
-    send_data((const uint8_t *)_screen_buffer, OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT * sizeof(pixel_t));
-  }
 
-  void SSD1351::draw_area_buffer()
-  {
-    send_data((const uint8_t *)_area_buffer, _dynamic_area.width * _dynamic_area.height * sizeof(pixel_t));
+    // restore the window of the dynamic area
+    if (sent)
+    {
+      set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+    }
   }
 
   void SSD1351::draw_screen_top_down()
@@ -499,12 +2223,97 @@ namespace oled
     }
   }
 
+  void SSD1351::draw_screen_scroll_top_down()
+  {
+    // the image rows go just above the displayed ones, wrapping around
+    // the RAM, while the start line moves up; at the end the screen
+    // starts OLED_SCREEN_HEIGHT rows higher
+    uint8_t startLine = _row_base;
+    _row_base = (_row_base + OLED_RAM_SPARE_ROWS) % OLED_RAM_ROWS;
+
+    uint8_t transStep = OLED_TRANSITION_STEP;
+    uint8_t done = 0;
+    while (done < OLED_SCREEN_HEIGHT)
+    {
+      // never write more rows than those hidden
+      uint8_t rows = transStep;
+      if (rows > OLED_RAM_SPARE_ROWS)
+      {
+        rows = OLED_RAM_SPARE_ROWS;
+      }
+      if (rows > OLED_SCREEN_HEIGHT - done)
+      {
+        rows = OLED_SCREEN_HEIGHT - done;
+      }
+
+      DynamicArea slice = {
+          .xCrd = 0,
+          .yCrd = (uint8_t)(OLED_SCREEN_HEIGHT - done - rows),
+          .width = OLED_SCREEN_WIDTH,
+          .height = rows};
+      draw_screen_window(slice);
+
+      done += rows;
+      set_start_line(startLine + OLED_RAM_ROWS - done);
+      transStep++;
+    }
+
+    set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+  }
+
+  void SSD1351::draw_screen_scroll_down_top()
+  {
+    // the image rows go just below the displayed ones, wrapping around
+    // the RAM, while the start line moves down; at the end the screen
+    // starts OLED_SCREEN_HEIGHT rows lower
+    uint8_t startLine = _row_base;
+    _row_base = (_row_base + OLED_SCREEN_HEIGHT) % OLED_RAM_ROWS;
+
+    uint8_t transStep = OLED_TRANSITION_STEP;
+    uint8_t done = 0;
+    while (done < OLED_SCREEN_HEIGHT)
+    {
+      // never write more rows than those hidden
+      uint8_t rows = transStep;
+      if (rows > OLED_RAM_SPARE_ROWS)
+      {
+        rows = OLED_RAM_SPARE_ROWS;
+      }
+      if (rows > OLED_SCREEN_HEIGHT - done)
+      {
+        rows = OLED_SCREEN_HEIGHT - done;
+      }
+
+      DynamicArea slice = {
+          .xCrd = 0,
+          .yCrd = done,
+          .width = OLED_SCREEN_WIDTH,
+          .height = rows};
+      draw_screen_window(slice);
+
+      done += rows;
+      set_start_line(startLine + done);
+      transStep++;
+    }
+
+    set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+  }
+
   void SSD1351::draw_screen_left_right()
   {
+    // the columns are sent top to bottom, which a window split over the
+    // end of the RAM can't take
+    if (border_rows(_dynamic_area, _row_base, 1) != 0)
+    {
+      draw_screen_slide_rows(true);
+      return;
+    }
+
     transpose_screen_buffer();
 
-    send_cmd({OLED_CMD_SET_REMAP, CMD_BYTE});
-    send_cmd({OLED_REMAP_SETTINGS | REMAP_VERTICAL_INCREMENT, DATA_BYTE});
+    send_cmds(CommandList()
+                  .add({OLED_CMD_SET_REMAP, CMD_BYTE})
+                  .add({OLED_REMAP_SETTINGS | REMAP_VERTICAL_INCREMENT, DATA_BYTE}));
 
     uint16_t transStep = OLED_TRANSITION_STEP;
     uint16_t partImgSize = _dynamic_area.height * transStep;
@@ -530,18 +2339,26 @@ namespace oled
       transStep++;
     }
 
-    send_cmd({OLED_CMD_SET_REMAP, CMD_BYTE});
-    send_cmd({OLED_REMAP_SETTINGS, DATA_BYTE});
+    send_cmds(CommandList()
+                  .add({OLED_CMD_SET_REMAP, CMD_BYTE})
+                  .add({OLED_REMAP_SETTINGS, DATA_BYTE}));
 
     transpose_screen_buffer();
   }
 
   void SSD1351::draw_screen_right_left()
   {
+    if (border_rows(_dynamic_area, _row_base, 1) != 0)
+    {
+      draw_screen_slide_rows(false);
+      return;
+    }
+
     transpose_screen_buffer();
 
-    send_cmd({OLED_CMD_SET_REMAP, CMD_BYTE});
-    send_cmd({OLED_REMAP_SETTINGS | REMAP_VERTICAL_INCREMENT, DATA_BYTE});
+    send_cmds(CommandList()
+                  .add({OLED_CMD_SET_REMAP, CMD_BYTE})
+                  .add({OLED_REMAP_SETTINGS | REMAP_VERTICAL_INCREMENT, DATA_BYTE}));
 
     uint16_t transStep = OLED_TRANSITION_STEP;
     uint16_t partImgSize = _dynamic_area.height * transStep;
@@ -567,78 +2384,239 @@ namespace oled
       transStep++;
     }
 
-    send_cmd({OLED_CMD_SET_REMAP, CMD_BYTE});
-    send_cmd({OLED_REMAP_SETTINGS, DATA_BYTE});
+    send_cmds(CommandList()
+                  .add({OLED_CMD_SET_REMAP, CMD_BYTE})
+                  .add({OLED_REMAP_SETTINGS, DATA_BYTE}));
 
     transpose_screen_buffer();
   }
 
-  Status SSD1351::draw_text(const char *text)
+  void SSD1351::draw_screen_slide_rows(bool leftToRight)
   {
-    if (_area_buffer == NULL)
+    // the same strips as the column by column transitions, sent row by row
+    uint8_t width = 0;
+    uint8_t transStep = OLED_TRANSITION_STEP;
+    while (width < _dynamic_area.width)
     {
-      return Status::AREA_NOT_SET;
+      width = _dynamic_area.width - width > transStep ? width + transStep : _dynamic_area.width;
+      transStep++;
+
+      // left to right the strip shows the right side of the image
+      uint8_t x = leftToRight ? _dynamic_area.xCrd : _dynamic_area.xCrd + _dynamic_area.width - width;
+      uint8_t imageX = leftToRight ? _dynamic_area.width - width : 0;
+      set_buffer_border(x, _dynamic_area.yCrd, width, _dynamic_area.height);
+
+      start_ram_write();
+      for (uint8_t y = _dynamic_area.yCrd; y < _dynamic_area.yCrd + _dynamic_area.height; y++)
+      {
+        write_ram((const uint8_t *)(_screen_buffer + y * OLED_SCREEN_WIDTH + _dynamic_area.xCrd + imageX),
+                  width * sizeof(pixel_t));
+      }
+      _transport->deselect();
     }
 
-    int charCount = 0;
-    int lines = get_line_count(text);
+    set_buffer_border(_dynamic_area.xCrd, _dynamic_area.yCrd, _dynamic_area.width, _dynamic_area.height);
+  }
 
-    // 1. Prepare background color and image
-    // create text background with image
-    if (_text_properties.bgImage != NULL)
+  bool SSD1351::get_layer_area(const Layer *layer, DynamicArea *area)
+  {
+    // the part of the layer inside the screen
+    int16_t x0 = layer->x < 0 ? 0 : layer->x;
+    int16_t y0 = layer->y < 0 ? 0 : layer->y;
+    int16_t x1 = layer->x + layer->width;
+    int16_t y1 = layer->y + layer->height;
+    if (x1 > OLED_SCREEN_WIDTH)
     {
-      update_screen_buffer(_text_properties.bgImage);
+      x1 = OLED_SCREEN_WIDTH;
     }
-
-    // populate area buffer with the bg color
-    for (size_t y = 0; y < _dynamic_area.height; y++)
+    if (y1 > OLED_SCREEN_HEIGHT)
     {
-      for (size_t x = 0; x < _dynamic_area.width; x++)
-      {
-        _area_buffer[y * _dynamic_area.width + x] = _screen_buffer[(y + _dynamic_area.yCrd) * OLED_SCREEN_WIDTH +
-                                                                   (x + _dynamic_area.xCrd)];
-      }
+      y1 = OLED_SCREEN_HEIGHT;
+    }
+    if (x0 >= x1 || y0 >= y1)
+    {
+      return false;
     }
 
-    // 2. Check for vertical overflow
-    if (lines * selectedFont_height > _dynamic_area.height)
+    area->xCrd = (uint8_t)x0;
+    area->yCrd = (uint8_t)y0;
+    area->width = (uint8_t)(x1 - x0);
+    area->height = (uint8_t)(y1 - y0);
+    return true;
+  }
+
+  Status SSD1351::compose_area(DynamicArea area)
+  {
+    // 1. Background, row by row
+    for (uint8_t y = area.yCrd; y < area.yCrd + area.height; y++)
     {
-      return Status::TEXT_OVERFLOW;
+      pixel_t *row = _screen_buffer + y * OLED_SCREEN_WIDTH + area.xCrd;
+      if (_scene_image != NULL)
+      {
+        memcpy(row, _scene_image + y * OLED_SCREEN_WIDTH + area.xCrd, area.width * sizeof(pixel_t));
+      }
+      else
+      {
+        for (uint8_t x = 0; x < area.width; x++)
+        {
+          row[x] = _scene_color;
+        }
+      }
     }
 
-    // 3. Loop each lines
-    for (int line = 0; line < lines; line++)
+    // 2. Layers over it, bottom to top, each clipped to the area
+    Status status = Status::SUCCESS;
+    for (uint8_t l = 0; l < _layer_count; l++)
     {
-      // 3.1. Get line width
-      int lineWidth = get_line_width(text + charCount);
-      
-      // 3.2. Check for line overflow
-      if (lineWidth > _dynamic_area.width)
+      const Layer *layer = _layers[l];
+      DynamicArea part;
+      if (!layer->visible || !get_layer_area(layer, &part))
       {
-        return Status::TEXT_OVERFLOW;
+        continue;
       }
 
-      uint8_t char_x_offset = 0,
-              char_y_offset = 0;
+      uint8_t x0 = part.xCrd > area.xCrd ? part.xCrd : area.xCrd;
+      uint8_t y0 = part.yCrd > area.yCrd ? part.yCrd : area.yCrd;
+      uint8_t x1 = part.xCrd + part.width < area.xCrd + area.width ? part.xCrd + part.width : area.xCrd + area.width;
+      uint8_t y1 = part.yCrd + part.height < area.yCrd + area.height ? part.yCrd + part.height : area.yCrd + area.height;
+      if (x0 >= x1 || y0 >= y1)
+      {
+        continue;
+      }
 
-      // 3.3. Compute text alignment
-      compute_alignment(lineWidth, line, lines, &char_x_offset, &char_y_offset);
+      // the area always holds the whole box of a text it crosses
+      if (layer->text != NULL)
+      {
+        if (compose_text(layer) != Status::SUCCESS)
+        {
+          status = Status::TEXT_OVERFLOW;
+        }
+        continue;
+      }
+      if (layer->image == NULL)
+      {
+        continue;
+      }
 
-      // 3.4. Write characters in their space in the area buffer one by one
-      while ((text[charCount] != 0) && (text[charCount] != '\n'))
+      const pixel_t *image = (const pixel_t *)layer->image;
+      pixel_t key = swap_color(layer->key);
+      uint8_t width = x1 - x0;
+      for (uint8_t y = y0; y < y1; y++)
       {
-        write_char_to_buffer(_area_buffer, text[charCount], &char_x_offset, &char_y_offset);
-        charCount++;
+        const pixel_t *src = image + (y - layer->y) * layer->width + (x0 - layer->x);
+        pixel_t *dst = _screen_buffer + y * OLED_SCREEN_WIDTH + x0;
+        if (!layer->keyed)
+        {
+          memcpy(dst, src, width * sizeof(pixel_t));
+          continue;
+        }
+        for (uint8_t x = 0; x < width; x++)
+        {
+          if (src[x] != key)
+          {
+            dst[x] = src[x];
+          }
+        }
       }
-      charCount++;
     }
 
+    return status;
+  }
+
+  Status SSD1351::compose_text(const Layer *layer)
+  {
+    // lay the text out in the box of the layer with its font and color,
+    // then give the text properties and the dynamic area back
+    TextProperties saved = _text_properties;
+    DynamicArea savedArea = _dynamic_area;
+    TextProperties prop = saved;
+    prop.font = layer->font;
+    prop.fontColor = layer->fontColor;
+    set_text_properties(&prop);
+
+    _dynamic_area.xCrd = (uint8_t)layer->x;
+    _dynamic_area.yCrd = (uint8_t)layer->y;
+    _dynamic_area.width = layer->width;
+    _dynamic_area.height = layer->height;
+
+    const TextLayout *layout;
+    Status status = cached_layout(layer->text, &layout);
+    if (status == Status::SUCCESS &&
+        (layout->lines * selectedFont_height > layer->height || layout->width > layer->width))
+    {
+      status = Status::TEXT_OVERFLOW;
+    }
+    if (status == Status::SUCCESS)
+    {
+      render_layout(layout);
+    }
+
+    _dynamic_area = savedArea;
+    set_text_properties(&saved);
+
+    return status;
+  }
+
+  Status SSD1351::draw_layout(const TextLayout *layout)
+  {
+    wait_transfer();
+
+    if (!_area_set)
+    {
+      return Status::AREA_NOT_SET;
+    }
+
+    // 1. Check for overflow
+    // the text is drawn straight into the screen buffer, so check every
+    // line before touching it
+    if (layout->lines * selectedFont_height > _dynamic_area.height ||
+        layout->width > _dynamic_area.width)
+    {
+      return Status::TEXT_OVERFLOW;
+    }
+
+    // 2. Prepare background image
+    if (_text_properties.bgImage != NULL)
+    {
+      update_screen_buffer(_text_properties.bgImage);
+    }
+
+    // 3. Write the lines in the screen buffer
+    render_layout(layout);
+
     // 4. Draw text to screen
-    draw_area_buffer();
+    draw_area();
 
     return Status::SUCCESS;
   }
 
+  void SSD1351::render_layout(const TextLayout *layout)
+  {
+    pixel_t *areaOrigin = _screen_buffer + _dynamic_area.yCrd * OLED_SCREEN_WIDTH + _dynamic_area.xCrd;
+    for (uint8_t line = 0; line < layout->lines; line++)
+    {
+      const TextLine &textLine = layout->line[line];
+      uint8_t char_x_offset = 0,
+              char_y_offset = 0;
+
+      // Compute text alignment
+      compute_alignment(textLine.width, line, layout->lines, &char_x_offset, &char_y_offset);
+
+      // Write characters in their space in the screen buffer one by one,
+      // at the columns of the layout while it has them
+      const char *text = layout->text + textLine.start;
+      uint8_t lineX = char_x_offset;
+      for (uint16_t i = 0; i < textLine.length; i++)
+      {
+        if (textLine.start + i < layout->glyphs)
+        {
+          char_x_offset = lineX + layout->glyphX[textLine.start + i];
+        }
+        write_char_to_buffer(areaOrigin, text[i], &char_x_offset, &char_y_offset);
+      }
+    }
+  }
+
   void SSD1351::compute_alignment(uint8_t lineWidth, uint8_t line_num, uint8_t lines,
                                   uint8_t *xOff, uint8_t *yOff)
   {
@@ -693,6 +2671,135 @@ namespace oled
                       ((uint32_t)charOffetTable[3] << 16);
     uint8_t charWidth = *charOffetTable;
     const uint8_t *charBitMap = _text_properties.font + offset;
+    pixel_t color = swap_color(_text_properties.fontColor);
+
+    // blend the alpha plane into what is already in the screen buffer
+    if (_antialias && _alpha_font != NULL)
+    {
+      const uint8_t *plane = _alpha_font->data +
+                             _alpha_font->offsets[charToWrite - selectedFont_firstChar];
+      uint8_t bpp = _alpha_font->bpp;
+      uint8_t opaque = (1 << bpp) - 1;
+      if (color != _blend_fg)
+      {
+        _blend_fg = color;
+        _blend_valid = 0;
+      }
+
+      for (uint8_t yCnt = 0; yCnt < selectedFont_height; ++yCnt)
+      {
+        pixel_t *row = buff + (yCnt + (*yOffset)) * OLED_SCREEN_WIDTH + (*xOffset);
+        uint8_t bits = 0, left = 0;
+        for (uint8_t xCnt = 0; xCnt < charWidth; ++xCnt)
+        {
+          if (left == 0)
+          {
+            bits = *plane++;
+            left = 8;
+
+            // skip a whole byte of transparent pixels
+            if (bits == 0)
+            {
+              xCnt += (8 / bpp) - 1;
+              left = 0;
+              continue;
+            }
+          }
+          uint8_t level = bits & opaque;
+
+          bits >>= bpp;
+          left -= bpp;
+
+          if (level == 0)
+          {
+            continue;
+          }
+          if (level == opaque)
+          {
+            row[xCnt] = color;
+            continue;
+          }
+
+          // backgrounds are mostly flat, so the blend is rarely computed
+          if (row[xCnt] != _blend_bg)
+          {
+            _blend_bg = row[xCnt];
+            _blend_valid = 0;
+          }
+          if (!(_blend_valid & (1 << level)))
+          {
+            pixel_t fg = _text_properties.fontColor;
+            pixel_t bg = swap_color(_blend_bg);
+            pixel_t mix = blend_color(fg, bg, (level * 32 + (opaque >> 1)) / opaque);
+            _blend_lut[level] = swap_color(mix);
+            _blend_valid |= 1 << level;
+          }
+          row[xCnt] = _blend_lut[level];
+        }
+      }
+
+      *xOffset += charWidth;
+      return;
+    }
+
+#if OLED_SPAN_FONTS
+    // span fonts are already made of runs, fill them straight from flash
+    if (_span_font != NULL)
+    {
+      uint16_t glyphIdx = charToWrite - _span_font->firstChar;
+      const uint8_t *record = _span_font->data + _span_font->offsets[glyphIdx];
+      uint8_t top = record[0];
+      uint8_t rows = record[1];
+      const uint8_t *counts = record + 2;
+      const uint8_t *spans = counts + ((rows + 1) >> 1);
+
+      pixel_t *row = buff + (top + (*yOffset)) * OLED_SCREEN_WIDTH + (*xOffset);
+      for (uint8_t r = 0; r < rows; r++)
+      {
+        uint8_t n = (counts[r >> 1] >> ((r & 1) << 2)) & 0x0F;
+        while (n--)
+        {
+          pixel_t *dst = row + (*spans >> 4);
+          uint8_t length = (*spans & 0x0F) + 1;
+          spans++;
+          while (length--)
+          {
+            *dst++ = color;
+          }
+        }
+        row += OLED_SCREEN_WIDTH;
+      }
+
+      *xOffset += _span_font->widths[glyphIdx];
+      return;
+    }
+#endif
+
+    // use the pre-rendered glyph when possible
+    const CachedGlyph *glyph = _glyph_cache.find(_text_properties.font, charToWrite, color);
+    if (glyph == NULL)
+    {
+      glyph = _glyph_cache.insert(_text_properties.font, charToWrite, color,
+                                  charBitMap, charWidth, selectedFont_height);
+    }
+    if (glyph != NULL)
+    {
+      for (uint8_t yCnt = 0; yCnt < glyph->height; ++yCnt)
+      {
+        pixel_t *row = buff + (yCnt + (*yOffset)) * OLED_SCREEN_WIDTH + (*xOffset);
+        for (uint8_t s = glyph->rowStart[yCnt]; s < glyph->rowStart[yCnt + 1]; s++)
+        {
+          pixel_t *dst = row + glyph->spans[s].x;
+          for (uint8_t n = 0; n < glyph->spans[s].length; n++)
+          {
+            *dst++ = glyph->color;
+          }
+        }
+      }
+
+      *xOffset += charWidth;
+      return;
+    }
 
     uint8_t foo = 0, mask;
     for (uint8_t yCnt = 0; yCnt < selectedFont_height; ++yCnt)
@@ -711,8 +2818,8 @@ namespace oled
         if ((foo & mask) != 0)
         {
           *(buff +
-            (yCnt + (*yOffset)) * _dynamic_area.width +
-            (xCnt + (*xOffset))) = (uint16_t)swap_color(_text_properties.fontColor);
+            (yCnt + (*yOffset)) * OLED_SCREEN_WIDTH +
+            (xCnt + (*xOffset))) = color;
         }
         mask <<= 1;
       }
@@ -721,42 +2828,108 @@ namespace oled
     *xOffset += charWidth;
   }
 
-  int SSD1351::get_line_count(const char *text)
+  uint8_t SSD1351::get_char_width(char c)
   {
-    uint8_t chrCnt = 0;
-    int lines = 1;
-    while (text[chrCnt] != 0)
+    if (c < selectedFont_firstChar || c > selectedFont_lastChar)
     {
-      if (text[chrCnt] == '\n')
-        lines++;
-      chrCnt++;
+      c = '?';
     }
-    return lines;
+    return *(_text_properties.font + 8 + (uint16_t)((c - selectedFont_firstChar) << 2));
   }
 
-  uint8_t SSD1351::get_line_width(const char *text)
+  Status SSD1351::layout_text(const char *text, TextLayout *layout)
   {
-    uint8_t chrCnt = 0;
-    uint8_t text_width = 0;
+    if (text == NULL || layout == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    layout->text = text;
+    layout->font = _text_properties.font;
+    layout->lines = 0;
+    layout->width = 0;
 
-    while ((text[chrCnt] != 0) && (text[chrCnt] != '\n'))
+    // one scan: split the lines, sum their glyph widths, with 1px
+    // between characters, and place the characters
+    size_t i = 0;
+    while (true)
     {
-      if (text[chrCnt] < selectedFont_firstChar || text[chrCnt] > selectedFont_lastChar)
+      if (layout->lines == OLED_TEXT_MAX_LINES)
       {
-        // Check for unsupported characters and replace them with '?'
-        text_width += *(_text_properties.font + 8 + (uint16_t)((text['?'] - selectedFont_firstChar) << 2));
+        return Status::TEXT_OVERFLOW;
       }
-      else
+
+      TextLine &line = layout->line[layout->lines++];
+      line.start = i;
+      line.width = 0;
+      uint16_t x = 0;
+      while (text[i] != 0 && text[i] != '\n')
+      {
+        uint8_t charWidth = get_char_width(text[i]);
+        if (i < OLED_TEXT_MAX_GLYPHS)
+        {
+          layout->glyphX[i] = x < 0xFF ? x : 0xFF;
+        }
+        // saturate, lines that long never fit anyway
+        if (line.width < 0xFF00)
+        {
+          line.width += charWidth + 1;
+          x += charWidth;
+        }
+        i++;
+      }
+      line.length = i - line.start;
+      // remove the final space
+      if (line.width > 0)
+      {
+        line.width--;
+      }
+      if (line.width > layout->width)
+      {
+        layout->width = line.width;
+      }
+
+      if (text[i] == 0)
+      {
+        layout->glyphs = i < OLED_TEXT_MAX_GLYPHS ? i : OLED_TEXT_MAX_GLYPHS;
+        return Status::SUCCESS;
+      }
+      i++;
+    }
+  }
+
+  Status SSD1351::cached_layout(const char *text, const TextLayout **layout)
+  {
+    if (text == NULL)
+    {
+      return Status::INVALID_TEXT;
+    }
+
+    // the same pointer may hold another text by now, so the contents are
+    // checked too; a plain scan is cheaper than measuring every glyph
+    uint32_t hash = hash_text(text);
+    for (uint8_t i = 0; i < OLED_TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+      CachedLayout &entry = _layout_cache[i];
+      if (entry.layout.text == text && entry.hash == hash &&
+          entry.layout.font == _text_properties.font)
       {
-        text_width += *(_text_properties.font + 8 + (uint16_t)((text[chrCnt] - selectedFont_firstChar) << 2));
+        *layout = &entry.layout;
+        return Status::SUCCESS;
       }
-      //  make 1px space between chars
-      text_width++;
-      chrCnt++;
     }
-    // remove the final space
-    if (text_width > 0)
-      text_width--;
-    return text_width;
+
+    // replace the oldest layout
+    CachedLayout &entry = _layout_cache[_layout_next];
+    _layout_next = (_layout_next + 1) % OLED_TEXT_LAYOUT_CACHE_SIZE;
+    entry.hash = hash;
+    Status status = layout_text(text, &entry.layout);
+    if (status != Status::SUCCESS)
+    {
+      entry.layout.text = NULL;
+      return status;
+    }
+    *layout = &entry.layout;
+    return Status::SUCCESS;
   }
 } // namespace oled
\ No newline at end of file
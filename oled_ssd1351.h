@@ -37,26 +37,56 @@
 #ifndef OLED_SSD1351_H_
 #define OLED_SSD1351_H_
 
-#include "mbed.h"
+#include <atomic>
+#include <stdlib.h>
+#include <string.h>
 #include "oled_info.h"
 #include "oled_types.h"
+#include "oled_transport.h"
+#if defined(__MBED__)
+#include "oled_spi_transport.h"
+#endif
+#include "oled_command_list.h"
+#include "oled_dirty_region.h"
+#include "oled_event.h"
+#include "oled_display_thread.h"
+#include "oled_image.h"
+#include "oled_image_source.h"
+#include "oled_glyph_cache.h"
+#include "font/span_font.h"
+#include "font/alpha_font.h"
 
 namespace oled
 {
     class SSD1351
     {
     public:
+#if defined(__MBED__)
         SSD1351(PinName mosiPin, PinName sclkPin,
                 PinName pwrPin, PinName csPin,
                 PinName rstPin, PinName dcPin);
+#endif
+        // Use a custom transport to talk with the OLED
+        // The transport is not owned by the driver
+        SSD1351(Transport *transport);
         ~SSD1351();
 
         // Dim OLED screen on
+        // This used to fade the contrast out over 320 ms, blocking the
+        // caller; it now changes at once. Animator::dim_screen() gives
+        // the fade back without blocking
         void dim_screen_on();
 
-        // Return OLED back to full contrast
+        // Return OLED back to full contrast, at once
         void dim_screen_off();
 
+        // Set the master and the color contrasts in a single command list
+        // Only the values that change are sent
+        void set_contrast(const Contrast &contrast);
+
+        // Get the contrast last set
+        void get_contrast(Contrast *contrast);
+
         // Turn on Power for OLED Display
         void power_on();
 
@@ -73,9 +103,67 @@ namespace oled
         // Used with set_dynamic_area() for positioning it
         Status draw_image(const uint8_t *image);
 
+        // Draw a compressed image to OLED; its size must match the dynamic area
+        // The rows are expanded in the screen buffer and sent one by one
+        // Used with set_dynamic_area() for positioning it
+        Status draw_image(const CompressedImage *image);
+
+        // Draw an image read from a source; it must fill the dynamic area
+        // The next rows are read while the previous ones are being sent
+        // Used with set_dynamic_area() for positioning it
+        Status draw_image(ImageSource *source);
+
         // Draw an image in the entire screen with a transition
         Status draw_screen(const uint8_t *image, Transition transition);
 
+        // Draw an image read from a source in the entire screen with a transition
+        // The diff mode does not apply to image sources
+        Status draw_screen(ImageSource *source, Transition transition);
+
+        // Draw a compressed image in the entire screen with a transition
+        // The diff mode does not apply to compressed images
+        Status draw_screen(const CompressedImage *image, Transition transition);
+
+        // Draw an image in the entire screen without waiting for the transfer
+        // The callback is invoked (possibly from interrupt context) when done
+        Status draw_screen_async(const uint8_t *image, TransferCallback callback, void *context);
+
+        // Draw an image to OLED without waiting for the transfer
+        // The image is sent as is, so it must stay valid until the callback
+        // Used with set_dynamic_area() for positioning it
+        Status draw_image_async(const uint8_t *image, TransferCallback callback, void *context);
+
+        // Check if an asynchronous transfer is still running
+        bool is_busy();
+
+        // Enable or disable the retained mode
+        // In retained mode drawing calls only update the screen buffer and
+        // the changed areas are sent to the OLED by flush()
+        void set_retained_mode(bool enable);
+
+        // Send all the areas changed since the last flush to the OLED
+        Status flush();
+
+#if OLED_RENDERER
+        // Start the renderer: drawing calls go to the back buffer, as in
+        // retained mode, and present() hands the changed areas over to a
+        // display thread that sends them while the next frame is drawn
+        void start_renderer();
+
+        // Hand the areas changed since the last present over to the
+        // display thread; waits only for the previous frame to be sent
+        // Without the renderer it is the same as flush()
+        Status present();
+
+        // Send the last frame, stop the display thread and leave retained mode
+        void stop_renderer();
+#endif
+
+        // Enable or disable the diff mode
+        // In diff mode draw_screen() without transition only sends
+        // the tiles that differ from the screen buffer
+        void set_diff_mode(bool enable);
+
         // Draw a box on the OLED
         // Used with set_dynamic_area() for positioning it
         Status draw_box(Color color);
@@ -83,63 +171,284 @@ namespace oled
         // Draw a single pixel
         Status draw_pixel(uint8_t x, uint8_t y, Color color);
 
+        // Draw many pixels at once, each with its own color
+        // Near pixels are sent together, with as few windows as possible;
+        // nothing is drawn if any point is outside the screen
+        Status draw_pixels(const Point *points, const Color *colors, uint16_t count);
+
+        // Draw many pixels at once, all with the same color
+        Status draw_pixels(const Point *points, uint16_t count, Color color);
+
+        // Draw a line between two points
+        Status draw_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, Color color);
+
+        // Draw the border of a box, stroke pixels wide
+        // Used with set_dynamic_area() for positioning it
+        Status draw_box_stroke(Color color, uint8_t stroke = 1);
+
+        // Draw the outline of a circle; it must fit in the screen
+        Status draw_circle(uint8_t xc, uint8_t yc, uint8_t radius, Color color);
+
+        // Draw a filled circle; it must fit in the screen
+        Status fill_circle(uint8_t xc, uint8_t yc, uint8_t radius, Color color);
+
+        // Draw the outline of a triangle
+        Status draw_triangle(Point a, Point b, Point c, Color color);
+
+        // Draw a filled triangle
+        Status fill_triangle(Point a, Point b, Point c, Color color);
+
         // Create a text box; recommended for dynamic text.
         // Used with set_dynamic_area() for positioning the text box.
         Status text_box(const char *text);
 
+        // Create a text box from a text laid out by layout_text()
+        // Used with set_dynamic_area() for positioning the text box.
+        Status text_box(const TextLayout *layout);
+
+        // Split a text in lines and measure them with the current font
+        Status layout_text(const char *text, TextLayout *layout);
+
         // Write text on the OLED at position x,y
         Status label(const char *text, uint8_t x, uint8_t y);
 
+        // Prepare a label in the given area, filled with the background color
+        Status create_label(Label *label, DynamicArea area, Color background);
+
+        // Change the text of a label with the current text properties
+        // Only the characters that changed are drawn and sent; everything
+        // is redrawn when the font, the color or the alignment changes
+        // The label becomes the dynamic area
+        Status update_label(Label *label, const char *text);
+
+        // Set the background of the scene: a full-screen image, or a color
+        // The whole screen is composed again by the next compose()
+        void set_scene_background(const uint8_t *image);
+        void set_scene_background(Color color);
+
+        // Put a layer on top of the others in the scene
+        // Text layers must fit in the screen, and a layer can only be
+        // in the scene once
+        Status add_layer(Layer *layer);
+
+        // Take a layer out of the scene
+        Status remove_layer(Layer *layer);
+
+        // Move a layer; only its old and new areas are composed again
+        Status move_layer(Layer *layer, int16_t x, int16_t y);
+
+        // Mark the area of a layer to be composed again, e.g. after
+        // changing its image, text or visibility
+        void invalidate_layer(Layer *layer);
+
+        // Compose the changed areas of the scene from the background and
+        // the layers, bottom to top, and send them to the OLED
+        // Text layers use the alignment of the text properties
+        Status compose();
+
         // Set the OLED text properties
         void set_text_properties(TextProperties *prop);
 
         // Get the OLED text properties
         void get_text_properties(TextProperties *prop);
 
+        // Set how many pre-rendered glyphs are kept in memory, 0 disables the cache
+        // Each glyph takes sizeof(CachedGlyph) bytes
+        void set_glyph_cache_size(uint8_t glyphs);
+
+        // Enable or disable anti-aliased text
+        // Fonts with an alpha version compiled in are blended into the
+        // screen buffer, whatever is behind them; the others stay 1-bit
+        void set_text_antialiasing(bool enable);
+
     private:
+        // Reset the OLED and send the init sequence
+        void init();
+
         // OLED device wires
-        SPI _spi;
-        DigitalOut _power;
-        DigitalOut _cs;
-        DigitalOut _rst;
-        DigitalOut _dc;
+        Transport *_own_transport;
+        Transport *_transport;
 
         // Font related variables
         TextProperties _text_properties;
         uint16_t selectedFont_firstChar;
         uint16_t selectedFont_lastChar;
         uint16_t selectedFont_height;
+        GlyphCache _glyph_cache;
+
+        // Layouts of the texts drawn last, found by text, contents and font
+        struct CachedLayout
+        {
+            uint32_t hash;
+            TextLayout layout;
+        };
+        CachedLayout _layout_cache[OLED_TEXT_LAYOUT_CACHE_SIZE];
+        uint8_t _layout_next;
+#if OLED_SPAN_FONTS
+        const SpanFont *_span_font;
+#endif
+
+        // Anti-aliased text state; blended colors are kept for the last
+        // font color and background color, one for each alpha level
+        bool _antialias;
+        const AlphaFont *_alpha_font;
+        pixel_t _blend_fg;
+        pixel_t _blend_bg;
+        uint16_t _blend_valid;
+        pixel_t _blend_lut[16];
+
+        // Contrast last sent to the OLED
+        Contrast _contrast;
 
         // Dynamic area
         DynamicArea _dynamic_area;
         pixel_t *_screen_buffer;
-        pixel_t *_area_buffer;
+        bool _area_set;
+#if OLED_STATIC_BUFFERS
+        pixel_t _screen_storage[OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT];
+#endif
+
+        // Retained mode state
+        bool _retained;
+        DirtyRegion _dirty;
+
+        // Pixels drawn by the running primitive and not sent yet, a bit per pixel
+        uint32_t _touched[OLED_SCREEN_HEIGHT][(OLED_SCREEN_WIDTH + 31) / 32];
+
+        // First RAM row of the displayed screen, moved by the scroll transitions
+        uint8_t _row_base;
+
+        // Window last set; one that crosses the last RAM row is set in two
+        // parts, switched when the bytes left in the current part run out
+        DynamicArea _window;
+        uint8_t _window_base;
+        bool _window_split;
+        uint8_t _window_part;
+        uint32_t _window_left;
 
-        // Send a command to the OLED
-        void send_cmd(Command cmd);
+#if OLED_RENDERER
+        // Renderer state; the front buffer and the frame rectangles belong
+        // to the display thread while _presenting is set, and _frame_sent
+        // is set when it hands them back
+        bool _rendering;
+        std::atomic<bool> _presenting;
+        Event _frame_sent;
+        pixel_t *_front_buffer;
+        DynamicArea _frame_rects[OLED_DIRTY_RECT_MAX];
+        uint8_t _frame_count;
+        uint8_t _frame_row_base;
+        DisplayThread _display_thread;
+#if OLED_STATIC_BUFFERS
+        pixel_t _front_storage[OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT];
+#endif
+#endif
+
+        // Scene state: layers bottom to top and areas to compose again
+        const pixel_t *_scene_image;
+        pixel_t _scene_color;
+        Layer *_layers[OLED_LAYERS_MAX];
+        uint8_t _layer_count;
+        DirtyRegion _scene_dirty;
+
+        // Diff mode state
+        bool _diff;
+        bool _screen_synced;
+
+        // Asynchronous transfer state; a call claims the transfer before
+        // preparing it and _busy is set while the bytes are on the wire
+        std::atomic<bool> _claimed;
+        std::atomic<bool> _busy;
+        Event _transfer_done;
+        TransferCallback _user_callback;
+        void *_user_context;
+
+        // Send a list of commands to the OLED in a single chip select
+        void send_cmds(const CommandList &commands);
+
+        // Send the write RAM command and leave the OLED selected for data
+        void start_ram_write();
 
         // Send raw data to the OLED
         void send_data(const uint8_t *dataToSend, uint32_t dataSize);
 
+        // Write pixels to the selected OLED, switching the parts of a split window
+        void write_ram(const uint8_t *data, uint32_t size);
+
+        // Send the same color to every pixel of the current window
+        void send_fill(pixel_t swappedColor, uint32_t pixels);
+
+        // Send raw data to the OLED without waiting for the transfer
+        void send_data_async(const uint8_t *dataToSend, uint32_t dataSize,
+                             TransferCallback callback, void *context);
+
+        // Wait for the running asynchronous transfer to complete
+        void wait_transfer();
+
+        // Called by the transport at the end of an asynchronous transfer
+        static void on_transfer_complete(void *context);
+
+        // Called by the transport at the end of a batch of streamed rows
+        static void on_batch_complete(void *context);
+
+#if OLED_RENDERER
+        // Wait for the display thread to send the presented frame
+        void wait_display();
+
+        // Run by the display thread for each presented frame
+        static void on_display_work(void *context);
+        void send_frame();
+#endif
+
         // Functions to manage the screen buffer
+        static uint8_t border_rows(DynamicArea area, uint8_t rowBase, uint8_t part);
+        static void add_border(CommandList *commands, DynamicArea area, uint8_t rowBase, uint8_t part = 0);
+        void track_border(DynamicArea area, uint8_t rowBase);
+        void next_window_part();
         void set_buffer_border(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
-        void update_screen_buffer(pixel_t *image);
+        void update_screen_buffer(const pixel_t *image);
         void transpose_screen_buffer();
         void draw_screen_buffer();
-        void draw_area_buffer();
+        void draw_area();
+        void draw_screen_window(DynamicArea area);
+        void send_screen_rows(DynamicArea area);
+        void write_rows(const pixel_t *buffer, DynamicArea area);
+        void send_window(DynamicArea area);
+        void decode_area(const CompressedImage *image);
+        Status stream_area(ImageSource *source);
+        bool read_rows(ImageSource *source, uint8_t y, uint8_t rows);
+
+        // Functions to draw primitives: plot into the screen buffer,
+        // then send the touched pixels with as few windows as possible
+        Status plot_pixels(const Point *points, const Color *colors, uint8_t colorStep, uint16_t count);
+        void plot(uint8_t x, uint8_t y, pixel_t swappedColor);
+        void plot_span(uint8_t x0, uint8_t x1, uint8_t y, pixel_t swappedColor);
+        void plot_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, pixel_t swappedColor);
+        void send_touched();
 
+        void draw_screen_diff(const uint8_t *image);
         // Functions to draw screen with transition
+        Status draw_transition(Transition transition);
         void draw_screen_top_down();
         void draw_screen_down_top();
         void draw_screen_left_right();
         void draw_screen_right_left();
+        void draw_screen_slide_rows(bool leftToRight);
+        void draw_screen_scroll_top_down();
+        void draw_screen_scroll_down_top();
+        void set_start_line(uint8_t row);
+
+        // Functions to compose the scene
+        bool get_layer_area(const Layer *layer, DynamicArea *area);
+        Status compose_area(DynamicArea area);
+        Status compose_text(const Layer *layer);
 
         // Functions to draw text
-        Status draw_text(const char *text);
+        Status cached_layout(const char *text, const TextLayout **layout);
+        Status draw_layout(const TextLayout *layout);
+        void render_layout(const TextLayout *layout);
         void compute_alignment(uint8_t lineWidth, uint8_t line_num, uint8_t lines, uint8_t *xOff, uint8_t *yOff);
         void write_char_to_buffer(pixel_t *buff, char charToWrite, uint8_t *xOffset, uint8_t *yOffset);
-        int get_line_count(const char *text);
-        uint8_t get_line_width(const char *text);
+        uint8_t get_char_width(char c);
     };
 } // namespace oled
 
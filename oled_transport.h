@@ -0,0 +1,62 @@
+/** OLED Transport
+ *  This file contains the interface used by the OLED driver to
+ *  talk with the SSD1351 controller.
+ *
+ *  The driver never touches the SPI peripheral directly: every command
+ *  and data byte goes through a Transport. This lets the driver stream
+ *  whole buffers in bulk on the target and run against a stub on a host.
+ */
+
+#ifndef OLED_TRANSPORT_H_
+#define OLED_TRANSPORT_H_
+
+#include <stdint.h>
+
+namespace oled
+{
+  // Function called when an asynchronous transfer is complete
+  typedef void (*TransferCallback)(void *context);
+
+  // Represent the link between the driver and the OLED controller:
+  // the SPI bus and the control pins
+  class Transport
+  {
+  public:
+    virtual ~Transport() {}
+
+    // Drive the power supply of the OLED
+    virtual void set_power(bool on) = 0;
+
+    // Drive the reset line; true holds the OLED in reset
+    virtual void set_reset(bool active) = 0;
+
+    // Wait for the given time
+    virtual void sleep_ms(uint32_t ms) = 0;
+
+    // Assert the chip select line
+    virtual void select() = 0;
+
+    // Release the chip select line
+    virtual void deselect() = 0;
+
+    // Drive the D/C line; true for data bytes, false for command bytes
+    virtual void set_data_mode(bool data) = 0;
+
+    // Write a block of bytes to the controller
+    // Must be called between select() and deselect()
+    virtual void write(const uint8_t *data, uint32_t size) = 0;
+
+    // Start writing a block of bytes and return immediately
+    // The callback is invoked once every byte has been sent, possibly
+    // from interrupt context; the data must stay valid until then.
+    // The default implementation is blocking.
+    virtual void write_async(const uint8_t *data, uint32_t size,
+                             TransferCallback callback, void *context)
+    {
+      write(data, size);
+      callback(context);
+    }
+  };
+} // namespace oled
+
+#endif // OLED_TRANSPORT_H_
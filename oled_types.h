@@ -48,7 +48,9 @@ namespace oled
     TOP_DOWN,
     DOWN_TOP,
     LEFT_RIGHT,
-    RIGHT_LEFT
+    RIGHT_LEFT,
+    SCROLL_TOP_DOWN, // the new image pushes the old one down, scrolled by the OLED
+    SCROLL_DOWN_TOP  // the new image pushes the old one up, scrolled by the OLED
   };
 
   // Represent all possible status
@@ -58,7 +60,11 @@ namespace oled
     COORD_ERROR,  // invalid coordinates
     AREA_NOT_SET, // using dynamic area w/out setting it
     INVALID_TEXT, // the given text string is null
-    TEXT_OVERFLOW // the given text is bigger than the set area
+    TEXT_OVERFLOW, // the given text is bigger than the set area
+    BUSY,          // an asynchronous transfer is still running
+    QUEUE_FULL,    // the draw queue has no free slot
+    READ_ERROR,    // the image source ended before the image
+    SCENE_FULL     // the scene already has OLED_LAYERS_MAX layers
   };
 
   // Redefine the type of a single pixel
@@ -76,6 +82,13 @@ namespace oled
     uint8_t height;
   };
 
+  // Represent a point of the screen
+  struct Point
+  {
+    uint8_t x;
+    uint8_t y;
+  };
+
   // Represent the most used colors
   enum Color
   {
@@ -111,6 +124,109 @@ namespace oled
     pixel_t *bgImage;
   };
 
+  // max number of lines of a TextLayout
+#ifndef OLED_TEXT_MAX_LINES
+#define OLED_TEXT_MAX_LINES (12)
+#endif
+
+  // Represent a line of a TextLayout
+  struct TextLine
+  {
+    uint16_t start;  // index of the first character in the text
+    uint16_t length; // number of characters
+    uint16_t width;  // width in pixels, 1px between characters
+  };
+
+  // max number of characters of a TextLayout given a position; the
+  // characters past it are placed by adding up the glyph widths
+#ifndef OLED_TEXT_MAX_GLYPHS
+#define OLED_TEXT_MAX_GLYPHS (64)
+#endif
+
+  // number of layouts kept by the driver for the texts drawn last
+#ifndef OLED_TEXT_LAYOUT_CACHE_SIZE
+#define OLED_TEXT_LAYOUT_CACHE_SIZE (4)
+#endif
+
+  // Represent a text split in lines and measured with a font
+  // Filled by layout_text(); it stays valid while the text and the font
+  // don't change, so it can be drawn many times without measuring again
+  struct TextLayout
+  {
+    const char *text;                     // text laid out
+    const uint8_t *font;                  // font used to measure it
+    uint8_t lines;                        // number of lines
+    uint16_t width;                       // width of the widest line
+    TextLine line[OLED_TEXT_MAX_LINES];   // the lines
+    uint16_t glyphs;                      // number of characters placed
+    uint8_t glyphX[OLED_TEXT_MAX_GLYPHS]; // column of each character in its line
+  };
+
+  // max number of characters of a Label
+#ifndef OLED_LABEL_MAX_CHARS
+#define OLED_LABEL_MAX_CHARS (16)
+#endif
+
+  // labels take the columns of their characters from the layout
+#if OLED_LABEL_MAX_CHARS > OLED_TEXT_MAX_GLYPHS
+#error "OLED_LABEL_MAX_CHARS can't be more than OLED_TEXT_MAX_GLYPHS"
+#endif
+
+  // Represent a single-line text that is updated in place
+  // Filled by create_label() and kept by the caller between updates
+  struct Label
+  {
+    DynamicArea area;                     // area of the label
+    Color background;                     // color behind the text
+    const uint8_t *font;                  // font of the text on screen
+    Color fontColor;                      // color of the text on screen
+    uint8_t yOffset;                      // row of the text in the area
+    uint8_t length;                       // number of characters on screen
+    char text[OLED_LABEL_MAX_CHARS];      // characters on screen
+    uint8_t xOffset[OLED_LABEL_MAX_CHARS]; // column of each character in the area
+  };
+
+  // max number of layers composed over the scene background
+#ifndef OLED_LAYERS_MAX
+#define OLED_LAYERS_MAX (8)
+#endif
+
+  // Represent a layer of the scene: a sprite, or a text when text is set
+  // Kept by the caller while it is in the scene; move it with move_layer()
+  // and call invalidate_layer() after changing anything else
+  struct Layer
+  {
+    int16_t x;            // column of the top left corner, may be off screen
+    int16_t y;            // row of the top left corner, may be off screen
+    uint8_t width;        // size of the sprite, or of the box of the text
+    uint8_t height;
+    const uint8_t *image; // sprite pixels, width x height as in draw_image()
+    bool keyed;           // if pixels of the key color are transparent
+    Color key;            // transparent color of the sprite
+    const char *text;     // text drawn in the box, NULL for a sprite
+    const uint8_t *font;  // font of the text
+    Color fontColor;      // color of the text
+    bool visible;         // hidden layers are skipped
+  };
+
+  // Represent the contrast of the OLED
+  struct Contrast
+  {
+    uint8_t master; // scale of every color, 0 to 15
+    uint8_t a;      // contrast of each color channel, 0 to 255
+    uint8_t b;
+    uint8_t c;
+  };
+
+  // Represent the shape of a change over time
+  enum class Easing : uint8_t
+  {
+    LINEAR,     // constant speed
+    EASE_IN,    // slow start
+    EASE_OUT,   // slow end
+    EASE_IN_OUT // slow start and end
+  };
+
   // Represent a command sent to the OLED
   struct Command
   {